@@ -27,11 +27,11 @@ Cmce::~Cmce()
  *
  */
 
-void Cmce::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Cmce::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_cmce", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_cmce", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
 
     std::string txt = "";
     uint32_t cid = 0;
@@ -185,12 +185,12 @@ void Cmce::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
 
     if (bCompletePrint)
     {
-        m_log->print(LogLevel::LOW, "service_cmce: TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu  cid=%u  ssi=%8u  usage_marker=%2u, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn,
+        LOG_PRINT(m_log, LogLevel::LOW, "service_cmce: TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu  cid=%u  ssi=%8u  usage_marker=%2u, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn,
                      txt.c_str(), pdu.size(), cid, m_macAddress.ssi, m_macAddress.usageMarker, m_macAddress.encryptionMode);
     }
     else
     {
-        m_log->print(LogLevel::LOW, "ser_cmce_sds: TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu \n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), pdu.size());
+        LOG_PRINT(m_log, LogLevel::LOW, "ser_cmce_sds: TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu \n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), pdu.size());
     }
 }
 
@@ -199,31 +199,25 @@ void Cmce::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
  *
  */
 
-void Cmce::parseDAlert(Pdu pdu)
+static constexpr PduField D_ALERT_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("call timeout, setup phase", 3),
+    fieldReserved(1),
+    fieldType1("simplex/duplex operation", 1),
+    fieldType1("call queued", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("basic service information", 8),
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_ALERT = pduLayout("CMCE", "D-ALERT", 5, D_ALERT_FIELDS);
+
+void Cmce::parseDAlert(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_alert", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_alert", pdu.toString().c_str());
 
-    m_report->start("CMCE", "D-ALERT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("call timeout, setup phase", pdu.getValue(pos, 3));
-    pos += 3;
-
-    pos += 1;                                                                   // reserved
-
-    m_report->add("simplex/duplex operation", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("call queued", pdu.getValue(pos, 1));
-    pos += 1;
-
-    // TODO type2 / 3 elements
-
-    m_report->send();
+    reportPduLayout(D_ALERT, pdu);
 }
 
 /**
@@ -231,29 +225,25 @@ void Cmce::parseDAlert(Pdu pdu)
  *
  */
 
-void Cmce::parseDCallProceeding(Pdu pdu)
+static constexpr PduField D_CALL_PROCEEDING_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("call timeout, setup phase", 3),
+    fieldType1("hook method selection", 1),
+    fieldType1("simplex/duplex selection", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("basic service information", 8),
+    fieldType2("call status", 3),
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_CALL_PROCEEDING = pduLayout("CMCE", "D-ALERT", 5, D_CALL_PROCEEDING_FIELDS);
+
+void Cmce::parseDCallProceeding(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_call_proceeding", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-ALERT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_call_proceeding", pdu.toString().c_str());
 
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("call timeout, setup phase", pdu.getValue(pos, 3));
-    pos += 3;
-
-    m_report->add("hook method selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("simplex/duplex selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    // TODO type2 / 3 elements
-
-    m_report->send();
+    reportPduLayout(D_CALL_PROCEEDING, pdu);
 }
 
 /**
@@ -261,76 +251,27 @@ void Cmce::parseDCallProceeding(Pdu pdu)
  *
  */
 
-void Cmce::parseDCallRestore(Pdu pdu)
+static constexpr PduField D_CALL_RESTORE_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldType1("reset call time-out timer T310", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("new call identifier", 14),
+    fieldType2("call time-out", 4),
+    fieldType2("call status", 3),
+    fieldType2("modify", 9),
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_CALL_RESTORE = pduLayout("CMCE", "D-CALL RESTORE", 5, D_CALL_RESTORE_FIELDS);
+
+void Cmce::parseDCallRestore(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_call_restore", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-CALL RESTORE", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_call_restore", pdu.toString().c_str());
 
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("reset call time-out timer T310", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-    if (oFlag)                                                                  // there is type2 or type3/4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("new call identifier", pdu.getValue(pos, 14));
-            pos += 14;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call time-out", pdu.getValue(pos, 4));
-            pos += 4;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call status", pdu.getValue(pos, 3));
-            pos += 3;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("modify", pdu.getValue(pos, 9));
-            pos += 9;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO handle type3/4 elements
-    }
-
-    m_report->send();
+    reportPduLayout(D_CALL_RESTORE, pdu);
 }
 
 /**
@@ -338,87 +279,29 @@ void Cmce::parseDCallRestore(Pdu pdu)
  *
  */
 
-void Cmce::parseDConnect(Pdu pdu)
+static constexpr PduField D_CONNECT_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("call timeout", 4),
+    fieldType1("hook method selection", 1),
+    fieldType1("simplex/duplex selection", 1),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldType1("call ownership", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("call priority", 4),
+    fieldType2("basic service information", 8),
+    fieldType2("temporary address", 24),
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_CONNECT = pduLayout("CMCE", "D-CONNECT", 5, D_CONNECT_FIELDS);
+
+void Cmce::parseDConnect(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_connect", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-CONNECT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("call timeout", pdu.getValue(pos, 4));
-    pos += 4;
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_connect", pdu.toString().c_str());
 
-    m_report->add("hook method selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("simplex/duplex selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("call ownership", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-    if (oFlag)                                                                  // there is type2 or type3/4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call priority", pdu.getValue(pos, 4));
-            pos += 4;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("basic service information", pdu.getValue(pos, 8));
-            pos += 8;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("temporary address", pdu.getValue(pos, 24));
-            pos += 24;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO
-        // uint8_t m_flag;                                                         // type 3/4 elements flag
-        // m_flag = pdu.getValue(pos, 1);
-        // pos += 1;
-
-        // while (m_flag)                                                          // it there type3/4 fields
-        // {
-        //     // facility and proprietary elements
-        //     m_report->add("type3 element id", json_object_new_int(pdu.getValue(pos, 4)));
-        //     pos += 4;
-        // }
-    }
-
-    m_report->send();
+    reportPduLayout(D_CONNECT, pdu);
 }
 
 /**
@@ -426,45 +309,23 @@ void Cmce::parseDConnect(Pdu pdu)
  *
  */
 
-void Cmce::parseDConnectAck(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_connect_ack", pdu.toString().c_str());
+static constexpr PduField D_CONNECT_ACK_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("call timeout", 4),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    m_report->start("CMCE", "D-CONNECT ACK", m_tetraTime, m_macAddress);
+static constexpr PduLayout D_CONNECT_ACK = pduLayout("CMCE", "D-CONNECT ACK", 5, D_CONNECT_ACK_FIELDS);
 
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("call timeout", pdu.getValue(pos, 4));
-    pos += 4;
-
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO handle type3/4
-    }
+void Cmce::parseDConnectAck(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_connect_ack", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_CONNECT_ACK, pdu);
 }
 
 /**
@@ -472,39 +333,21 @@ void Cmce::parseDConnectAck(Pdu pdu)
  *
  */
 
-void Cmce::parseDDisconnect(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_disconnect", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-DISCONNECT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("disconnect cause", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
+static constexpr PduField D_DISCONNECT_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("disconnect cause", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
+static constexpr PduLayout D_DISCONNECT = pduLayout("CMCE", "D-DISCONNECT", 5, D_DISCONNECT_FIELDS);
 
-        // TODO handle type3/4
-    }
+void Cmce::parseDDisconnect(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_disconnect", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_DISCONNECT, pdu);
 }
 
 /**
@@ -512,114 +355,31 @@ void Cmce::parseDDisconnect(Pdu pdu)
  *
  */
 
-void Cmce::parseDInfo(Pdu pdu)
+static constexpr PduField D_INFO_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("reset call time-out timer (T310)", 1),
+    fieldType1("poll request", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("new call identifier", 14),
+    fieldType2("call time-out", 4),
+    fieldType2("call time-out setup phase (T301, T302)", 3),
+    fieldType2("call ownership", 1),
+    fieldType2("modify", 9),
+    fieldType2("call status", 3),
+    fieldType2("temporary address", 24),
+    fieldType2("notification indicator", 6),
+    fieldType2("poll response percentage", 6),
+    fieldType2("poll response number", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_INFO = pduLayout("CMCE", "D-INFO", 5, D_INFO_FIELDS);
+
+void Cmce::parseDInfo(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_info", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-INFO", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("reset call time-out timer (T310)", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("poll request", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_info", pdu.toString().c_str());
 
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("new call identifier", pdu.getValue(pos, 14));
-            pos += 14;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call time-out", pdu.getValue(pos, 4));
-            pos += 4;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call time-out setup phase (T301, T302)", pdu.getValue(pos, 3));
-            pos += 3;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call ownership", pdu.getValue(pos, 1));
-            pos += 1;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("modify", pdu.getValue(pos, 9));
-            pos += 9;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("call status", pdu.getValue(pos, 3));
-            pos += 3;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("temporary address", pdu.getValue(pos, 24));
-            pos += 24;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("poll response percentage", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("poll response number", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO handle type3/4
-    }
-
-    m_report->send();
+    reportPduLayout(D_INFO, pdu);
 }
 
 /**
@@ -627,39 +387,21 @@ void Cmce::parseDInfo(Pdu pdu)
  *
  */
 
-void Cmce::parseDRelease(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_release", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-RELEASE", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("disconnect cause", pdu.getValue(pos, 5));
-    pos += 5;
+static constexpr PduField D_RELEASE_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("disconnect cause", 5),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
+static constexpr PduLayout D_RELEASE = pduLayout("CMCE", "D-RELEASE", 5, D_RELEASE_FIELDS);
 
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO handle type3/4
-    }
+void Cmce::parseDRelease(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_release", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_RELEASE, pdu);
 }
 
 /**
@@ -667,96 +409,33 @@ void Cmce::parseDRelease(Pdu pdu)
  *
  */
 
-void Cmce::parseDSetup(Pdu pdu)
+static constexpr PduField D_SETUP_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("call timeout", 4),
+    fieldType1("hook method selection", 1),
+    fieldType1("simplex/duplex selection", 1),
+    fieldType1("basic service information", 8),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldType1("call priority", 4),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldType2("temporary address", 24),
+    fieldType2("calling party type identifier", 2),                             // field 11, selects the address below
+    fieldIf("calling party ssi", 8, 11, 0),
+    fieldIf("calling party ssi", 24, 11, 1),
+    fieldIf("calling party ssi", 24, 11, 2),
+    fieldIf("calling party ext", 24, 11, 2),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_SETUP = pduLayout("CMCE", "D-SETUP", 5, D_SETUP_FIELDS);
+
+void Cmce::parseDSetup(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_setup", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-SETUP", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("call timeout", pdu.getValue(pos, 4));
-    pos += 4;
-
-    m_report->add("hook method selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("simplex/duplex selection", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("basic service information", pdu.getValue(pos, 8));
-    pos += 8;
-
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("call priority", pdu.getValue(pos, 4));
-    pos += 4;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("temporary address", pdu.getValue(pos, 24));
-            pos += 24;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)                                                              // calling party type identifier
-        {
-            uint8_t cpti = pdu.getValue(pos, 2);
-            pos += 2;
-            m_report->add("calling party type identifier", cpti);
-
-            if (cpti == 0)                                                      // SNA ? not documented
-            {
-                m_report->add("calling party ssi", pdu.getValue(pos, 8));
-                pos += 8;
-            }
-            else if (cpti == 1)
-            {
-                m_report->add("calling party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-            else if (cpti == 2)
-            {
-                m_report->add("calling party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-
-                m_report->add("calling party ext", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-        }
-
-        // TODO handle type 3/4
-        // uint8_t m_flag;
-        // m_flag = pdu.getValue(pos, 1);
-        // pos += 1;
-    }
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_setup", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_SETUP, pdu);
 }
 
 /**
@@ -764,39 +443,21 @@ void Cmce::parseDSetup(Pdu pdu)
  *
  */
 
-void Cmce::parseDTxCeased(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_ceased", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-TX CEASED", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
+static constexpr PduField D_TX_CEASED_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("transmission request permission", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
+static constexpr PduLayout D_TX_CEASED = pduLayout("CMCE", "D-TX CEASED", 5, D_TX_CEASED_FIELDS);
 
-        // TODO handle type3/4
-    }
+void Cmce::parseDTxCeased(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_ceased", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_TX_CEASED, pdu);
 }
 
 /**
@@ -804,42 +465,22 @@ void Cmce::parseDTxCeased(Pdu pdu)
  *
  */
 
-void Cmce::parseDTxContinue(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_continue", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-TX CONTINUE", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("continue", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
+static constexpr PduField D_TX_CONTINUE_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("continue", 1),
+    fieldType1("transmission request permission", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
+static constexpr PduLayout D_TX_CONTINUE = pduLayout("CMCE", "D-TX CONTINUE", 5, D_TX_CONTINUE_FIELDS);
 
-        // TODO handle type3/4
-    }
+void Cmce::parseDTxContinue(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_continue", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_TX_CONTINUE, pdu);
 }
 
 /**
@@ -847,75 +488,29 @@ void Cmce::parseDTxContinue(Pdu pdu)
  *
  */
 
-void Cmce::parseDTxGranted(Pdu pdu)
+static constexpr PduField D_TX_GRANTED_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldType1("encryption control", 1),
+    fieldReserved(1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldType2("transmission party type identifier", 2),                        // field 7, selects the address below
+    fieldIf("transmitting party ssi", 8, 7, 0),
+    fieldIf("transmitting party ssi", 24, 7, 1),
+    fieldIf("transmitting party ssi", 24, 7, 2),
+    fieldIf("transmitting party ext", 24, 7, 2),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_TX_GRANTED = pduLayout("CMCE", "D-TX GRANTED", 5, D_TX_GRANTED_FIELDS);
+
+void Cmce::parseDTxGranted(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_granted", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-TX GRANTED", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
-
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_granted", pdu.toString().c_str());
 
-    m_report->add("encryption control", pdu.getValue(pos, 1));
-    pos += 1;
-
-    pos += 1;                                                                   // reserved and must be set to 0
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            uint8_t tpti = pdu.getValue(pos, 2);
-            pos += 2;
-            m_report->add("transmission party type identifier", tpti);
-
-            if (tpti == 0)                                                      // SNA ? not documented
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 8));
-                pos += 8;
-            }
-            else if (tpti == 1)
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-            else if (tpti == 2)
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-
-                m_report->add("transmitting party ext", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-        }
-
-        // TODO handle type3/4
-    }
-
-    m_report->send();
+    reportPduLayout(D_TX_GRANTED, pdu);
 }
 
 /**
@@ -923,75 +518,29 @@ void Cmce::parseDTxGranted(Pdu pdu)
  *
  */
 
-void Cmce::parseDTxInterrupt(Pdu pdu)
+static constexpr PduField D_TX_INTERRUPT_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("transmission grant", 2),
+    fieldType1("transmission request permission", 1),
+    fieldType1("encryption control", 1),
+    fieldReserved(1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldType2("transmission party type identifier", 2),                        // field 7, selects the address below
+    fieldIf("transmitting party ssi", 8, 7, 0),
+    fieldIf("transmitting party ssi", 24, 7, 1),
+    fieldIf("transmitting party ssi", 24, 7, 2),
+    fieldIf("transmitting party ext", 24, 7, 2),
+    fieldMbit(),                                                                // type 3/4 elements
+};
+
+static constexpr PduLayout D_TX_INTERRUPT = pduLayout("CMCE", "D-TX INTERRUPT", 5, D_TX_INTERRUPT_FIELDS);
+
+void Cmce::parseDTxInterrupt(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_interrupt", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-TX INTERRUPT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_interrupt", pdu.toString().c_str());
 
-    m_report->add("transmission grant", pdu.getValue(pos, 2));
-    pos += 2;
-
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
-
-    m_report->add("encryption control", pdu.getValue(pos, 1));
-    pos += 1;
-
-    pos += 1;                                                                   // reserved and must be set to 0
-
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            uint8_t tpti = pdu.getValue(pos, 2);
-            pos += 2;
-            m_report->add("transmission party type identifier", tpti);
-
-            if (tpti == 0)                                                      // SNA ? not documented
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 8));
-                pos += 8;
-            }
-            else if (tpti == 1)
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-            else if (tpti == 2)
-            {
-                m_report->add("transmitting party ssi", pdu.getValue(pos, 24));
-                pos += 24;
-
-                m_report->add("transmitting party ext", pdu.getValue(pos, 24));
-                pos += 24;
-            }
-        }
-
-        // TODO handle type3/4
-    }
-
-    m_report->send();
+    reportPduLayout(D_TX_INTERRUPT, pdu);
 }
 
 /**
@@ -999,37 +548,19 @@ void Cmce::parseDTxInterrupt(Pdu pdu)
  *
  */
 
-void Cmce::parseDTxWait(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_wait", pdu.toString().c_str());
-
-    m_report->start("CMCE", "D-TX WAIT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 5;                                                           // pdu type
-
-    m_report->add("call identifier", pdu.getValue(pos, 14));
-    pos += 14;
+static constexpr PduField D_TX_WAIT_FIELDS[] = {
+    fieldType1("call identifier", 14),
+    fieldType1("transmission request permission", 1),
+    fieldObit(),                                                                // there is type2, type3 or type4 fields
+    fieldType2("notification indicator", 6),
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    m_report->add("transmission request permission", pdu.getValue(pos, 1));
-    pos += 1;
+static constexpr PduLayout D_TX_WAIT = pduLayout("CMCE", "D-TX WAIT", 5, D_TX_WAIT_FIELDS);
 
-    uint8_t oFlag = pdu.getValue(pos, 1);                                       // option flag
-    pos += 1;
-
-    if (oFlag)                                                                  // there is type2, type3 or type4 fields
-    {
-        uint8_t pFlag;                                                          // presence flag
-
-        pFlag = pdu.getValue(pos, 1);
-        pos += 1;
-        if (pFlag)
-        {
-            m_report->add("notification indicator", pdu.getValue(pos, 6));
-            pos += 6;
-        }
-
-        // TODO handle type3/4
-    }
+void Cmce::parseDTxWait(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_parse_d_tx_wait", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_TX_WAIT, pdu);
 }
@@ -15,25 +15,25 @@ namespace Tetra {
         Cmce(Log * log, Report * report, Sds * sds);
         ~Cmce();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
         Sds * m_sds;
 
-        void parseDAlert(Pdu pdu);
-        void parseDCallProceeding(Pdu pdu);
-        void parseDCallRestore(Pdu pdu);
-        void parseDConnect(Pdu pdu);
-        void parseDConnectAck(Pdu pdu);
-        void parseDDisconnect(Pdu pdu);
-        void parseDInfo(Pdu pdu);
-        void parseDRelease(Pdu pdu);
-        void parseDSetup(Pdu pdu);
-        void parseDTxCeased(Pdu pdu);
-        void parseDTxContinue(Pdu pdu);
-        void parseDTxGranted(Pdu pdu);
-        void parseDTxInterrupt(Pdu pdu);
-        void parseDTxWait(Pdu pdu);
+        void parseDAlert(const Pdu & pdu);
+        void parseDCallProceeding(const Pdu & pdu);
+        void parseDCallRestore(const Pdu & pdu);
+        void parseDConnect(const Pdu & pdu);
+        void parseDConnectAck(const Pdu & pdu);
+        void parseDDisconnect(const Pdu & pdu);
+        void parseDInfo(const Pdu & pdu);
+        void parseDRelease(const Pdu & pdu);
+        void parseDSetup(const Pdu & pdu);
+        void parseDTxCeased(const Pdu & pdu);
+        void parseDTxContinue(const Pdu & pdu);
+        void parseDTxGranted(const Pdu & pdu);
+        void parseDTxInterrupt(const Pdu & pdu);
+        void parseDTxWait(const Pdu & pdu);
     };
 
 };
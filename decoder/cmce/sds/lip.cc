@@ -30,11 +30,11 @@ Lip::~Lip()
  *
  */
 
-void Lip::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Lip::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_service_location_information_protocol", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_service_location_information_protocol", pdu.toString().c_str());
 
     uint32_t pos = 0;                                                           // protocol ID from SDS has been removed since LIP is a service with SDU
 
@@ -64,9 +64,9 @@ void Lip::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
  *
  */
 
-void Lip::parseShortLocationReport(Pdu pdu)
+void Lip::parseShortLocationReport(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_lip_parse_short_location_report", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_lip_parse_short_location_report", pdu.toString().c_str());
 
     static const std::size_t MIN_SIZE = 68;
 
@@ -127,9 +127,9 @@ void Lip::parseShortLocationReport(Pdu pdu)
  *
  */
 
-void Lip::parseExtendedMessage(Pdu pdu)
+void Lip::parseExtendedMessage(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_lip_parse_extended_message", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_lip_parse_extended_message", pdu.toString().c_str());
 
     uint32_t pos = 2;                                                           // pdu type
 
@@ -15,11 +15,11 @@ namespace Tetra {
         Lip(Log * log, Report * report);
         ~Lip();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
-        void parseShortLocationReport(Pdu pdu);
-        void parseExtendedMessage(Pdu pdu);
+        void parseShortLocationReport(const Pdu & pdu);
+        void parseExtendedMessage(const Pdu & pdu);
 
         double decodeLipLatitude(uint32_t latitude);
         double decodeLipLongitude(uint32_t longitude);
@@ -35,7 +35,7 @@ Sds::~Sds()
  *
  */
 
-void Sds::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Sds::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
@@ -68,9 +68,9 @@ void Sds::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
  *
  */
 
-void Sds::parseDSdsData(Pdu pdu)
+void Sds::parseDSdsData(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_d_sds_data", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_d_sds_data", pdu.toString().c_str());
 
     m_report->start("CMCE", "D-SDS-DATA", m_tetraTime, m_macAddress);
 
@@ -163,9 +163,9 @@ void Sds::parseDSdsData(Pdu pdu)
  *
  */
 
-void Sds::parseDStatus(Pdu pdu)
+void Sds::parseDStatus(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_d_status", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_d_status", pdu.toString().c_str());
 
     m_report->start("CMCE", "D-STATUS", m_tetraTime, m_macAddress);
 
@@ -228,9 +228,9 @@ void Sds::parseDStatus(Pdu pdu)
  *   TODO check maximum length for user-defined data 4 is 2047 bits including protocol identifier 14.8.52
  */
 
-void Sds::parseType4Data(Pdu pdu, const uint16_t len)
+void Sds::parseType4Data(const Pdu & pdu, const uint16_t len)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_type4_data", len, pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_type4_data", len, pdu.toString().c_str());
 
     if ((pdu.size() < len) || (len > 2047))
     {
@@ -375,9 +375,9 @@ void Sds::parseType4Data(Pdu pdu, const uint16_t len)
  *
  */
 
-void Sds::parseSubDTransfer(Pdu pdu, const uint16_t len)
+void Sds::parseSubDTransfer(const Pdu & pdu, const uint16_t len)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_sub_d_transfer", len, pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_sub_d_transfer", len, pdu.toString().c_str());
 
     uint32_t pos = 0;
 
@@ -518,9 +518,9 @@ void Sds::parseSubDTransfer(Pdu pdu, const uint16_t len)
  *
  */
 
-void Sds::parseSimpleTextMessaging(Pdu pdu, const uint16_t len)
+void Sds::parseSimpleTextMessaging(const Pdu & pdu, const uint16_t len)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_simple_text_messaging", len, pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - len = %u pdu = %s\n", "cmce_sds_parse_simple_text_messaging", len, pdu.toString().c_str());
 
     uint32_t pos = 8;                                                           // protocol id
 
@@ -564,9 +564,9 @@ void Sds::parseSimpleTextMessaging(Pdu pdu, const uint16_t len)
  *
  */
 
-void Sds::parseTextMessagingWithSdsTl(Pdu pdu)
+void Sds::parseTextMessagingWithSdsTl(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_text_messaging_with_sds_tl", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_text_messaging_with_sds_tl", pdu.toString().c_str());
 
     // Table 28.29 - 29.5.3.3
     uint16_t len = pdu.size();
@@ -612,9 +612,9 @@ void Sds::parseTextMessagingWithSdsTl(Pdu pdu)
  *
  */
 
-void Sds::parseSimpleLocationSystem(Pdu pdu, const uint16_t len)
+void Sds::parseSimpleLocationSystem(const Pdu & pdu, const uint16_t len)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_simple_location_system", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_simple_location_system", pdu.toString().c_str());
 
     uint32_t pos = 8;                                                           // protocol id
 
@@ -654,9 +654,9 @@ void Sds::parseSimpleLocationSystem(Pdu pdu, const uint16_t len)
  *
  */
 
-void Sds::parseLocationSystemWithSdsTl(Pdu pdu)
+void Sds::parseLocationSystemWithSdsTl(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_location_system_with_sds_tl", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "cmce_sds_parse_location_system_with_sds_tl", pdu.toString().c_str());
 
     uint16_t len = pdu.size();
     uint32_t pos = 0;
@@ -15,20 +15,20 @@ namespace Tetra {
         Sds(Log * log, Report * report);
         ~Sds();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
         Lip * m_lip;
 
-        void parseDSdsData(Pdu pdu);
-        void parseDStatus(Pdu pdu);
-        void parseType4Data(Pdu pdu, const uint16_t len);
-        void parseSubDTransfer(Pdu pdu, const uint16_t len);
-        void parseSimpleTextMessaging(Pdu pdu, const uint16_t len);
-        void parseTextMessagingWithSdsTl(Pdu pdu);
-        void parseSimpleLocationSystem(Pdu pdu, const uint16_t len);
-        void parseLocationSystemWithSdsTl(Pdu pdu);
-        void parseLip(Pdu pdu);
+        void parseDSdsData(const Pdu & pdu);
+        void parseDStatus(const Pdu & pdu);
+        void parseType4Data(const Pdu & pdu, const uint16_t len);
+        void parseSubDTransfer(const Pdu & pdu, const uint16_t len);
+        void parseSimpleTextMessaging(const Pdu & pdu, const uint16_t len);
+        void parseTextMessagingWithSdsTl(const Pdu & pdu);
+        void parseSimpleLocationSystem(const Pdu & pdu, const uint16_t len);
+        void parseLocationSystemWithSdsTl(const Pdu & pdu);
+        void parseLip(const Pdu & pdu);
     };
 
 };
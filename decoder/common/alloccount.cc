@@ -0,0 +1,79 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "alloccount.h"
+
+using namespace Tetra;
+
+#ifdef DEBUG_ALLOC_COUNT
+
+static thread_local uint64_t gThreadAllocations = 0;                            // constant initialized, safe before main
+static std::atomic<uint64_t> gDecodingPasses(0);
+static std::atomic<uint64_t> gDecodingPassesAllocations(0);
+
+void * operator new(std::size_t size)
+{
+    gThreadAllocations++;
+
+    void * ptr = std::malloc(size ? size : 1);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+uint64_t AllocCount::thread()
+{
+    return gThreadAllocations;
+}
+
+void AllocCount::addDecodingPass(const uint64_t allocations)
+{
+    gDecodingPasses.fetch_add(1, std::memory_order_relaxed);
+    gDecodingPassesAllocations.fetch_add(allocations, std::memory_order_relaxed);
+}
+
+uint64_t AllocCount::decodingPasses()
+{
+    return gDecodingPasses.load();
+}
+
+uint64_t AllocCount::decodingPassesAllocations()
+{
+    return gDecodingPassesAllocations.load();
+}
+
+#else
+
+uint64_t AllocCount::thread()
+{
+    return 0;
+}
+
+void AllocCount::addDecodingPass(const uint64_t)
+{
+}
+
+uint64_t AllocCount::decodingPasses()
+{
+    return 0;
+}
+
+uint64_t AllocCount::decodingPassesAllocations()
+{
+    return 0;
+}
+
+#endif
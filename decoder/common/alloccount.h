@@ -0,0 +1,29 @@
+#ifndef ALLOCCOUNT_H
+#define ALLOCCOUNT_H
+#include <cstdint>
+
+/**
+ * @defgroup tetra_common Heap allocations debug counter
+ *
+ * Only active when built with -DDEBUG_ALLOC_COUNT, which replaces the global
+ * operator new to count allocations per thread. Used to check that channel
+ * decoding (Mac::decodeBurstBlocks) does no heap allocation in steady state.
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    namespace AllocCount {
+        uint64_t thread();                                                      // heap allocations done by calling thread
+        void addDecodingPass(const uint64_t allocations);                       // account one channel decoding pass and its allocations
+        uint64_t decodingPasses();                                              // channel decoding passes count
+        uint64_t decodingPassesAllocations();                                   // heap allocations during channel decoding passes
+    };
+
+};
+
+/** @} */
+
+#endif /* ALLOCCOUNT_H */
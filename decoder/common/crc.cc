@@ -0,0 +1,146 @@
+#include <cstring>
+#include "crc.h"
+
+using namespace Tetra;
+
+/**
+ * @brief MSB first CRC tables for one byte, built once at program start
+ *
+ */
+
+struct CrcTables {
+    uint16_t crc16Ccitt[256];
+    uint32_t crc32[256];
+
+    CrcTables()
+    {
+        for (uint32_t val = 0; val < 256; val++)
+        {
+            uint16_t crc16 = (uint16_t)(val << 8);
+            uint32_t crc32 = val << 24;
+
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc16 = (crc16 & 0x8000) ? (uint16_t)((crc16 << 1) ^ 0x1021) : (uint16_t)(crc16 << 1); // CRC16-CCITT polynomial
+                crc32 = (crc32 & 0x80000000) ? (crc32 << 1) ^ 0x04C11DB7 : (crc32 << 1);               // CRC-32 polynomial
+            }
+
+            crc16Ccitt[val] = crc16;
+            this->crc32[val] = crc32;
+        }
+    }
+};
+
+static const CrcTables gCrcTables;
+
+/**
+ * @brief Pack 8 unpacked bits, first bit is MSB
+ *
+ */
+
+static inline uint8_t packByte(const uint8_t * bits)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint64_t val;
+    std::memcpy(&val, bits, 8);
+    return (uint8_t)(((val & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56); // gather bit 0 of each byte, first byte to MSB
+#else
+    uint8_t res = 0;
+    for (int idx = 0; idx < 8; idx++)
+    {
+        res = (uint8_t)((res << 1) | (bits[idx] & 1));
+    }
+    return res;
+#endif
+}
+
+/**
+ * @brief CRC16-CCITT of len bits, not complemented
+ *
+ */
+
+uint16_t Crc::crc16Ccitt(const uint8_t * bits, const std::size_t len, uint16_t crc)
+{
+    std::size_t idx = 0;
+
+    for (; idx + 8 <= len; idx += 8)
+    {
+        crc = (uint16_t)((crc << 8) ^ gCrcTables.crc16Ccitt[(crc >> 8) ^ packByte(bits + idx)]);
+    }
+
+    for (; idx < len; idx++)
+    {
+        crc ^= (uint16_t)(bits[idx] << 15);
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief CRC-32 of len bits, not complemented
+ *
+ */
+
+uint32_t Crc::crc32(const uint8_t * bits, const std::size_t len, uint32_t crc)
+{
+    std::size_t idx = 0;
+
+    for (; idx + 8 <= len; idx += 8)
+    {
+        crc = (crc << 8) ^ gCrcTables.crc32[(crc >> 24) ^ packByte(bits + idx)];
+    }
+
+    for (; idx < len; idx++)
+    {
+        crc ^= (uint32_t)bits[idx] << 31;
+        crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief CRC-32 continued over the len <= 64 low bits of word, first bit is MSB
+ *
+ * Chain calls to process a PDU 64 bits at a time, eg. with Pdu::getValue().
+ *
+ */
+
+uint32_t Crc::crc32(const uint64_t word, const std::size_t len, uint32_t crc)
+{
+    std::size_t left = len;                                                     // bits not processed yet, the lowest ones
+
+    for (; left >= 8; left -= 8)
+    {
+        crc = (crc << 8) ^ gCrcTables.crc32[(crc >> 24) ^ (uint8_t)(word >> (left - 8))];
+    }
+
+    for (; left > 0; left--)
+    {
+        crc ^= (uint32_t)((word >> (left - 1)) & 1) << 31;
+        crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief Check block of len bits ending with its complemented CRC16-CCITT - 8.2.3.2
+ *
+ */
+
+bool Crc::checkCrc16Ccitt(const uint8_t * bits, const std::size_t len)
+{
+    return crc16Ccitt(bits, len) == CRC16_CCITT_RESIDUE;
+}
+
+/**
+ * @brief Check block of len bits ending with its complemented CRC-32 (LLC FCS)
+ *
+ */
+
+bool Crc::checkCrc32(const uint8_t * bits, const std::size_t len)
+{
+    return crc32(bits, len) == CRC32_RESIDUE;
+}
@@ -0,0 +1,42 @@
+#ifndef CRC_H
+#define CRC_H
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @defgroup tetra_common Table-driven CRC
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Table-driven CRC over unpacked bits (one bit per byte, MSB first)
+     *
+     * Bits are packed 8 at a time and processed with a 256 entries table, the
+     * remaining bits (len not multiple of 8) are processed bitwise.
+     * Bits must be 0 or 1. CRC-32 can also be computed over packed words, so
+     * packed PDUs are checked without unpacking them.
+     *
+     */
+
+    class Crc {
+    public:
+        static const uint16_t CRC16_CCITT_RESIDUE = 0x1D0F;                    ///< CRC16-CCITT remainder of a valid block with its complemented CRC
+        static const uint32_t CRC32_RESIDUE       = 0xC704DD7B;                ///< CRC-32 remainder of a valid block with its complemented FCS
+
+        static uint16_t crc16Ccitt(const uint8_t * bits, const std::size_t len, uint16_t crc = 0xFFFF);
+        static uint32_t crc32(const uint8_t * bits, const std::size_t len, uint32_t crc = 0xFFFFFFFF);
+        static uint32_t crc32(const uint64_t word, const std::size_t len, uint32_t crc); // len <= 64 low bits of word, MSB first
+
+        static bool checkCrc16Ccitt(const uint8_t * bits, const std::size_t len);
+        static bool checkCrc32(const uint8_t * bits, const std::size_t len);
+    };
+
+};
+
+/** @} */
+
+#endif /* CRC_H */
@@ -40,7 +40,7 @@ void Layer::service(const MacLogicalChannel macLogicalChannel, TetraTime tetraTi
  *
  */
 
-void Layer::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Layer::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     service(macLogicalChannel, tetraTime, macAddress);
 }
@@ -50,7 +50,7 @@ void Layer::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTim
  *
  */
 
-void Layer::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode)
+void Layer::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode)
 {
     service(macLogicalChannel, tetraTime, macAddress);
 }
@@ -84,3 +84,39 @@ std::string Layer::valueToString(std::string key, uint32_t val)
 {
     return "not found";
 }
+
+/**
+ * @brief Decode PDU with its layout and send report
+ *
+ * Fields are decoded in one pass to a flat array, then present ones are added
+ * to the report in layout order, followed by the type 3/4 elements when the
+ * M-bit is set.
+ *
+ */
+
+void Layer::reportPduLayout(const PduLayout & layout, const Pdu & pdu)
+{
+    PduFieldValue values[PDU_LAYOUT_MAX_FIELDS];
+    const uint32_t pos = pduLayoutDecode(layout, pdu, values);
+
+    m_report->start(layout.service, layout.name, m_tetraTime, m_macAddress);
+    pduLayoutReport(layout, values, m_report);
+    if (pduLayoutHasType34(layout, values))
+    {
+        parseType34Elements(pdu, pos);
+    }
+    m_report->send();
+}
+
+/**
+ * @brief Report type 3/4 elements starting at their M-bit, to be overloaded by
+ *        layers which decode them
+ *
+ * @return position after the elements, unchanged when not decoded
+ *
+ */
+
+uint64_t Layer::parseType34Elements(const Pdu & /*pdu*/, uint64_t pos)
+{
+    return pos;
+}
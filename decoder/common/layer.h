@@ -5,6 +5,7 @@
 #include "log.h"
 #include "report.h"
 #include "pdu.h"
+#include "pdulayout.h"
 
 namespace Tetra {
 
@@ -22,8 +23,8 @@ namespace Tetra {
         virtual ~Layer();
 
         virtual void service(const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
-        virtual void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
-        virtual void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode);
+        virtual void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        virtual void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode);
 
     protected:
         Log    * m_log;                                                         ///< Screen logger
@@ -35,6 +36,8 @@ namespace Tetra {
 
         virtual std::string getMapValue(std::map<uint32_t, std::string> informationElement, uint32_t val); ///< Find string in map for a given value
         virtual std::string valueToString(std::string key, uint32_t val);                                  ///< Map string to value builder to be used with getMapValue
+        virtual uint64_t parseType34Elements(const Pdu & pdu, uint64_t pos);                               ///< Report type 3/4 elements from their first M-bit
+        void reportPduLayout(const PduLayout & layout, const Pdu & pdu);                                   ///< Decode PDU with its layout and send report
     };
 
 };
@@ -33,9 +33,36 @@ namespace Tetra {
         void print(const LogLevel level, const char * fmt, ...);
         LogLevel getLevel();
 
+        /**
+         * @brief Return true when messages of this level are printed
+         *
+         */
+
+        bool isEnabled(const LogLevel level) const
+        {
+            return level <= m_level;
+        }
+
     private:
         LogLevel m_level;                                                       ///< Minimum log level
     };
 };
 
+/**
+ * @brief Print message with logger only when level is enabled
+ *
+ * The level is checked before the arguments are evaluated, so building them
+ * (eg. pdu.toString() or channel names) costs nothing when level is disabled.
+ * Use it instead of calling Log::print() directly.
+ *
+ */
+
+#define LOG_PRINT(log, level, ...)                                              \
+    do {                                                                        \
+        if ((log)->isEnabled(level))                                            \
+        {                                                                       \
+            (log)->print(level, __VA_ARGS__);                                   \
+        }                                                                       \
+    } while (0)
+
 #endif /* LOG_H */
@@ -7,9 +7,8 @@ using namespace Tetra;
  *
  */
 
-Pdu::Pdu()
+Pdu::Pdu() : m_offset(0), m_size(0)
 {
-    m_vec.clear();
 }
 
 /**
@@ -22,13 +21,10 @@ Pdu::Pdu()
  *
  */
 
-Pdu::Pdu(const Pdu & pdu, const uint32_t startPos, const int32_t length)
+Pdu::Pdu(const Pdu & pdu, const uint32_t startPos, const int32_t length) : m_offset(0), m_size(0)
 {
-    // clear internal vector
-    m_vec.clear();
-
     // calculate actual length after start position
-    int32_t actualLen = (int32_t)pdu.m_vec.size() - (int32_t)startPos;
+    int32_t actualLen = (int32_t)pdu.m_size - (int32_t)startPos;
 
     // check if we have remaining data after start position and requested length is positive or null (ie. whole pdu copy)
     if ((actualLen > 0) && (length >= 0))
@@ -39,7 +35,9 @@ Pdu::Pdu(const Pdu & pdu, const uint32_t startPos, const int32_t length)
             actualLen = length;
         }
 
-        m_vec.assign(pdu.m_vec.begin() + (size_t)startPos, pdu.m_vec.begin() + (size_t)startPos + (size_t)actualLen);
+        m_buffer = pdu.m_buffer;                                                // view of the same bits, no copy
+        m_offset = pdu.m_offset + startPos;
+        m_size   = (std::size_t)actualLen;
     }
 }
 
@@ -51,9 +49,19 @@ Pdu::Pdu(const Pdu & pdu, const uint32_t startPos, const int32_t length)
  *
  */
 
-Pdu::Pdu(const std::vector<uint8_t> & val)
+Pdu::Pdu(const std::vector<uint8_t> & val) : m_offset(0), m_size(0)
+{
+    appendBits(val.data(), val.size());
+}
+
+/**
+ * @brief Constructor from a view of bits (copied)
+ *
+ */
+
+Pdu::Pdu(Span<const uint8_t> val) : m_offset(0), m_size(0)
 {
-    m_vec = val;
+    appendBits(val.data(), val.size());
 }
 
 /**
@@ -67,32 +75,208 @@ Pdu::~Pdu()
 }
 
 /**
- * @brief
+ * @brief Make room for len bits, moving to heap storage when longer than INLINE_BITS
  *
  */
 
-void Pdu::clear()
+void Pdu::Buffer::reserve(const std::size_t len)
 {
-    m_vec.clear();
+    const std::size_t count = (len + 63) / 64;
+
+    if (bHeap)
+    {
+        if (count > heapWords.size())
+        {
+            heapWords.resize(count);                                            // geometric growth of vector capacity
+        }
+    }
+    else if (count > INLINE_WORDS)
+    {
+        heapWords.assign(inlineWords, inlineWords + (size + 63) / 64);
+        heapWords.resize(count);
+        bHeap = true;
+    }
 }
 
 /**
- * @brief
+ * @brief 64 bits starting at position, first bit as MSB, bits after PDU end are 0
  *
  */
 
-uint64_t Pdu::getValue(const uint64_t startPos, const uint8_t fieldLen)
+uint64_t Pdu::getWord(const std::size_t startPos) const
 {
-    uint64_t val = 0;
+    if (startPos >= m_size)
+    {
+        return 0;
+    }
+
+    const std::size_t pos   = m_offset + startPos;                              // position in buffer
+    const std::size_t last  = (m_offset + m_size - 1) / 64;                     // last word of PDU
+    const std::size_t idx   = pos / 64;
+    const unsigned    shift = (unsigned)(pos % 64);
 
-    for (uint64_t pos = 0; (pos < fieldLen) && (pos + startPos < m_vec.size()); pos++)
+    const uint64_t * data = m_buffer->words();
+
+    uint64_t val = data[idx] << shift;
+    if ((shift > 0) && (idx < last))
     {
-        val += (m_vec[pos + startPos] << (fieldLen - pos - 1));
+        val |= data[idx + 1] >> (64 - shift);
+    }
+
+    const std::size_t remaining = m_size - startPos;
+    if (remaining < 64)
+    {
+        val &= ~(~(uint64_t)0 >> remaining);                                    // bits after end, in buffer or not
     }
 
     return val;
 }
 
+/**
+ * @brief Make the PDU the only owner of a buffer ending with its last bit, with room for len more bits
+ *
+ * Bits are copied to a new buffer when the buffer is shared (copy on write), otherwise
+ * the buffer is truncated to the PDU end (eg. after resize()).
+ *
+ */
+
+void Pdu::prepareAppend(const std::size_t len)
+{
+    if (m_buffer && (m_buffer.use_count() == 1))
+    {
+        Buffer * buffer = m_buffer.get();
+        const std::size_t end = m_offset + m_size;
+
+        if (buffer->size > end)
+        {
+            buffer->size = end;
+            if (end % 64)
+            {
+                buffer->words()[end / 64] &= ~(~(uint64_t)0 >> (end % 64));    // appended bits are ORed in the last word
+            }
+        }
+
+        buffer->reserve(end + len);
+        return;
+    }
+
+    std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();               // one allocation up to INLINE_BITS bits
+    buffer->reserve(m_size + len);
+
+    uint64_t * data = buffer->words();
+    for (std::size_t pos = 0; pos < m_size; pos += 64)                          // copy 64 bits at a time, realigned on buffer start
+    {
+        data[pos / 64] = getWord(pos);
+    }
+    buffer->size = m_size;
+
+    m_buffer = buffer;
+    m_offset = 0;
+}
+
+/**
+ * @brief Write the len (1 to 64) first bits of word at buffer end, first bit as MSB, other bits of word are ignored
+ *
+ * Buffer must have room for them, see prepareAppend().
+ *
+ */
+
+void Pdu::Buffer::push(const uint64_t word, const std::size_t len)
+{
+    const uint64_t val = (len < 64) ? word & ~(~(uint64_t)0 >> len) : word;  // keep bits after end at 0
+
+    uint64_t * data = words();
+    const std::size_t idx   = size / 64;
+    const unsigned    shift = (unsigned)(size % 64);
+
+    if (shift == 0)
+    {
+        data[idx] = val;                                                        // new word
+    }
+    else
+    {
+        data[idx] |= val >> shift;
+        if (shift + len > 64)
+        {
+            data[idx + 1] = val << (64 - shift);
+        }
+    }
+
+    size += len;
+}
+
+/**
+ * @brief Append bits stored one per byte
+ *
+ */
+
+void Pdu::appendBits(const uint8_t * bits, const std::size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+
+    prepareAppend(len);
+
+    for (std::size_t pos = 0; pos < len; pos += 64)                             // pack 64 bits at a time
+    {
+        const std::size_t count = (len - pos < 64) ? len - pos : 64;
+
+        uint64_t val = 0;
+        std::size_t idx = 0;
+        for (; idx + 8 <= count; idx += 8)                                      // 8 bits per multiplication
+        {
+            const uint8_t * src = bits + pos + idx;
+            const uint64_t bytes = ((uint64_t)src[0]       | (uint64_t)src[1] << 8  | // first bit in the low byte,
+                                    (uint64_t)src[2] << 16 | (uint64_t)src[3] << 24 | // merged in one load by compiler
+                                    (uint64_t)src[4] << 32 | (uint64_t)src[5] << 40 |
+                                    (uint64_t)src[6] << 48 | (uint64_t)src[7] << 56) & 0x0101010101010101;
+            val |= ((bytes * 0x8040201008040201) >> 56) << (56 - idx);          // gathers byte k bit 0 to bit 7 - k of the top byte
+        }
+        for (; idx < count; idx++)
+        {
+            val |= (uint64_t)(bits[pos + idx] & 0x01) << (63 - idx);
+        }
+        m_buffer->push(val, count);
+    }
+
+    m_size += len;
+}
+
+/**
+ * @brief
+ *
+ */
+
+void Pdu::clear()
+{
+    m_buffer.reset();
+    m_offset = 0;
+    m_size   = 0;
+}
+
+/**
+ * @brief Value of the field of fieldLen bits at startPos, MSB first
+ *
+ * Bits after PDU end are read as 0. Fields longer than 64 bits give their last 64 bits.
+ *
+ */
+
+uint64_t Pdu::getValue(const uint64_t startPos, const uint8_t fieldLen) const
+{
+    if (fieldLen == 0)
+    {
+        return 0;
+    }
+    else if (fieldLen > 64)
+    {
+        return getWord((std::size_t)startPos + fieldLen - 64);
+    }
+
+    return getWord((std::size_t)startPos) >> (64 - fieldLen);
+}
+
 /**
  * @brief
  *
@@ -100,7 +284,9 @@ uint64_t Pdu::getValue(const uint64_t startPos, const uint8_t fieldLen)
 
 void Pdu::append(const uint8_t val)
 {
-    m_vec.push_back(val);
+    prepareAppend(1);
+    m_buffer->push((uint64_t)(val & 0x01) << 63, 1);
+    m_size++;
 }
 
 /**
@@ -108,9 +294,9 @@ void Pdu::append(const uint8_t val)
  *
  */
 
-void Pdu::append(const std::vector<uint8_t> vec)
+void Pdu::append(const std::vector<uint8_t> & vec)
 {
-    m_vec.insert(m_vec.end(), vec.begin(), vec.end());
+    appendBits(vec.data(), vec.size());
 }
 
 /**
@@ -118,9 +304,21 @@ void Pdu::append(const std::vector<uint8_t> vec)
  *
  */
 
-void Pdu::append(const Pdu val)
+void Pdu::append(const Pdu & val)
 {
-    append(val.m_vec);
+    if (val.m_size == 0)
+    {
+        return;
+    }
+
+    prepareAppend(val.m_size);                                                  // fragments concatenation: bits are copied once
+
+    for (std::size_t pos = 0; pos < val.m_size; pos += 64)                      // 64 bits at a time
+    {
+        m_buffer->push(val.getWord(pos), (val.m_size - pos < 64) ? val.m_size - pos : 64);
+    }
+
+    m_size += val.m_size;
 }
 
 /**
@@ -128,10 +326,10 @@ void Pdu::append(const Pdu val)
  *
  */
 
-std::string Pdu::toString(const int len)
+std::string Pdu::toString(const int len) const
 {
     std::string res   = "";
-    std::size_t count = m_vec.size();
+    std::size_t count = m_size;
 
     if ((len > 0) && (len < (int)count))                                        // if len is 0 then print entire vector
     {
@@ -140,7 +338,7 @@ std::string Pdu::toString(const int len)
 
     for (std::size_t idx = 0; idx < count; idx++)
     {
-        res += (char)(m_vec[idx] + '0');
+        res += (char)(at(idx) + '0');
     }
 
     return res;
@@ -151,13 +349,13 @@ std::string Pdu::toString(const int len)
  *
  */
 
-std::string Pdu::toHex()
+std::string Pdu::toHex() const
 {
     std::string txt = "";
     char buf[32] = "";
 
     uint32_t pos = 0;
-    for (std::size_t cnt = 0; cnt < m_vec.size() / 8; cnt++)
+    for (std::size_t cnt = 0; cnt < m_size / 8; cnt++)
     {
         uint8_t val = getValue(pos, 8);
         pos += 8;
@@ -182,7 +380,7 @@ std::string Pdu::toHex()
  *
  */
 
-void Pdu::print(const int len)
+void Pdu::print(const int len) const
 {
     std::cout << toString(len) << std::endl;
 }
@@ -192,27 +390,12 @@ void Pdu::print(const int len)
  *
  */
 
-void Pdu::toPackedUInt8(uint8_t * data)
+void Pdu::toPackedUInt8(uint8_t * data) const
 {
-    size_t idx;
-    uint8_t curByte = 0;
-
-    for (idx = 0; idx < m_vec.size(); idx++)
+    for (std::size_t pos = 0; pos < m_size; pos += 8)                           // last byte is padded with 0 for a non-modulo-8 bitcount
     {
-        uint8_t bitnum = (uint8_t)(7 - (idx % 8));
-
-        curByte |= (m_vec[idx] << bitnum);
-
-        if((idx % 8) == 7)
-        {
-            *data++ = curByte;
-            curByte = 0;
-        }
+        *data++ = (uint8_t)getValue(pos, 8);
     }
-
-    // we have a non-modulo-8 bitcount
-    if (idx % 8)
-        *data++ = curByte;
 }
 
 /**
@@ -222,9 +405,9 @@ void Pdu::toPackedUInt8(uint8_t * data)
 
 void Pdu::resize(const std::size_t len)
 {
-    if ((len > 0) && (len < m_vec.size()))
+    if ((len > 0) && (len < m_size))
     {
-        m_vec.resize(len);
+        m_size = len;                                                           // buffer is left as is, it may be shared
     }
 }
 
@@ -233,9 +416,9 @@ void Pdu::resize(const std::size_t len)
  *
  */
 
-std::size_t Pdu::size()
+std::size_t Pdu::size() const
 {
-    return m_vec.size();
+    return m_size;
 }
 
 /**
@@ -243,11 +426,12 @@ std::size_t Pdu::size()
  *
  */
 
-uint8_t Pdu::at(const std::size_t pos)
+uint8_t Pdu::at(const std::size_t pos) const
 {
-    if (pos < m_vec.size())
+    if (pos < m_size)
     {
-        return m_vec[pos];
+        const std::size_t bit = m_offset + pos;
+        return (uint8_t)((m_buffer->words()[bit / 64] >> (63 - bit % 64)) & 0x01);
     }
     else
     {
@@ -260,9 +444,9 @@ uint8_t Pdu::at(const std::size_t pos)
  *
  */
 
-bool Pdu::isEmpty()
+bool Pdu::isEmpty() const
 {
-    return (m_vec.size() == 0);
+    return (m_size == 0);
 }
 
 /**
@@ -270,13 +454,13 @@ bool Pdu::isEmpty()
  *
  */
 
-std::vector<uint8_t> Pdu::extractVec(const uint32_t startPos, const int32_t length)
+std::vector<uint8_t> Pdu::extractVec(const uint32_t startPos, const int32_t length) const
 {
     std::vector<uint8_t> ret;
 
     if (length > 0)                                                             // valid length requested
     {
-        int32_t len = (int32_t)m_vec.size() - (int32_t)startPos;                // actual remaining bytes in vector after pos
+        int32_t len = (int32_t)m_size - (int32_t)startPos;                      // actual remaining bits after pos
 
         if (len > 0)                                                            // check if actual length is valid
         {
@@ -285,7 +469,11 @@ std::vector<uint8_t> Pdu::extractVec(const uint32_t startPos, const int32_t leng
                 len = length;                                                   // so return only the requested ones
             }
 
-            std::copy(m_vec.begin() + startPos, m_vec.begin() + startPos + (uint32_t)len, back_inserter(ret));
+            ret.reserve((std::size_t)len);
+            for (int32_t pos = 0; pos < len; pos++)
+            {
+                ret.push_back(at(startPos + (uint32_t)pos));
+            }
         }
     }
 
@@ -297,7 +485,7 @@ std::vector<uint8_t> Pdu::extractVec(const uint32_t startPos, const int32_t leng
  *
  */
 
-std::string Pdu::textGsm7BitDecode(const int16_t len)
+std::string Pdu::textGsm7BitDecode(const int16_t len) const
 {
     // NOTE: _ is a special char when we want to escape the character value
     //                   0        10         20        30         40        50        60        70        80        90        100       110      120
@@ -331,7 +519,7 @@ std::string Pdu::textGsm7BitDecode(const int16_t len)
  *
  */
 
-std::string Pdu::textGeneric8BitDecode(const int16_t len)
+std::string Pdu::textGeneric8BitDecode(const int16_t len) const
 {
     std::string res = "";
 
@@ -358,7 +546,7 @@ std::string Pdu::textGeneric8BitDecode(const int16_t len)
  *
  */
 
-std::string Pdu::locationNmeaDecode(const int16_t len)
+std::string Pdu::locationNmeaDecode(const int16_t len) const
 {
     std::string res = "";
 
@@ -1,49 +1,100 @@
 #ifndef PDU_H
 #define PDU_H
 #include <cstdint>
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include <string>
 #include <iostream>
 #include "tetra.h"
+#include "span.h"
 
 namespace Tetra {
 
     /**
      * @brief Pdu base class contains functions useful for manipulating
-     *        vector<uint8_t> data
+     *        bits data
+     *
+     * A PDU is a view (offset and length) of a buffer of bits packed in 64-bit
+     * words, first bit as MSB of the first word, so fields are extracted with a
+     * shift and a mask over at most two words. Buffers are reference counted and
+     * shared by copies and slices, so stripping a header (sub-PDU constructor)
+     * doesn't copy any payload bit. Appending to a PDU whose buffer is shared
+     * copies its bits to a new buffer first (copy on write), eg. when MAC
+     * fragments are concatenated. Bits after size() are always read as 0.
      *
      */
 
     class Pdu {
     public:
+        static const std::size_t INLINE_BITS = 512;                             ///< Longest PDU whose buffer is allocated in one block
+
         Pdu();
         Pdu(const std::vector<uint8_t> & val);
+        Pdu(Span<const uint8_t> val);
         Pdu(const Pdu & pdu, const uint32_t startPos, const int32_t length = 0);
         ~Pdu();
 
         void append(const uint8_t val);
-        void append(const std::vector<uint8_t> vec);
-        void append(const Pdu val);
+        void append(const std::vector<uint8_t> & vec);
+        void append(const Pdu & val);
         void clear();
-        void print(const int len = 0);
+        void print(const int len = 0) const;
         void resize(const std::size_t len);
 
-        uint8_t at(const std::size_t pos);
-        std::vector<uint8_t> extractVec(const uint32_t startPos, const int32_t length);
-        uint64_t getValue(const uint64_t startPos, const uint8_t fieldLen);
-        bool isEmpty();
-        std::size_t size();
-        std::string toHex();
-        std::string toString(const int len = 0);
-        void toPackedUInt8(uint8_t * data);
+        uint8_t at(const std::size_t pos) const;
+        std::vector<uint8_t> extractVec(const uint32_t startPos, const int32_t length) const;
+        uint64_t getValue(const uint64_t startPos, const uint8_t fieldLen) const;
+        bool isEmpty() const;
+        std::size_t size() const;
+        std::string toHex() const;
+        std::string toString(const int len = 0) const;
+        void toPackedUInt8(uint8_t * data) const;
 
         // TETRA specific functions
-        std::string textGsm7BitDecode(const int16_t len);
-        std::string textGeneric8BitDecode(const int16_t len);
-        std::string locationNmeaDecode(const int16_t len);
+        std::string textGsm7BitDecode(const int16_t len) const;
+        std::string textGeneric8BitDecode(const int16_t len) const;
+        std::string locationNmeaDecode(const int16_t len) const;
 
     private:
-        std::vector<uint8_t> m_vec;                                             ///< Internal PDU data storage as vector of uint8_t
+        static const std::size_t INLINE_WORDS = INLINE_BITS / 64;
+
+        /**
+         * @brief Packed bits shared by a PDU, its copies and its slices
+         *
+         */
+
+        struct Buffer {
+            std::size_t size;                                                   ///< Bits written
+            bool bHeap;                                                         ///< Bits are stored in heapWords instead of inlineWords
+            uint64_t inlineWords[INLINE_WORDS];                                 ///< Inline packed bits storage
+            std::vector<uint64_t> heapWords;                                    ///< Heap packed bits storage for long PDUs
+
+            Buffer() : size(0), bHeap(false)
+            {
+            }
+
+            uint64_t * words()
+            {
+                return bHeap ? heapWords.data() : inlineWords;
+            }
+
+            const uint64_t * words() const
+            {
+                return bHeap ? heapWords.data() : inlineWords;
+            }
+
+            void reserve(const std::size_t len);
+            void push(const uint64_t word, const std::size_t len);
+        };
+
+        std::shared_ptr<Buffer> m_buffer;                                       ///< Bits storage, NULL when PDU is empty
+        std::size_t m_offset;                                                   ///< Position of first bit in buffer
+        std::size_t m_size;                                                     ///< Bits count
+
+        uint64_t getWord(const std::size_t startPos) const;
+        void prepareAppend(const std::size_t len);
+        void appendBits(const uint8_t * bits, const std::size_t len);
     };
 };
 
@@ -0,0 +1,104 @@
+#include "pdulayout.h"
+
+using namespace Tetra;
+
+/**
+ * @brief Decode fields of a PDU layout in one pass
+ *
+ * Fields after a cleared O-bit, type 2 elements whose P-bit is cleared and fields
+ * whose condition is not met are not present. Bits after the PDU end are read as 0
+ * like Pdu::getValue() does.
+ *
+ * The M-bit is read but not consumed: each type 3/4 element starts with its own
+ * M-bit (E.1.1), so the layer decodes them from the returned position.
+ *
+ * @param layout  PDU layout
+ * @param pdu     PDU to decode
+ * @param values  Decoded fields (layout.count values)
+ *
+ * @return position after the last decoded field, or of the M-bit
+ *
+ */
+
+uint32_t Tetra::pduLayoutDecode(const PduLayout & layout, const Pdu & pdu, PduFieldValue * values)
+{
+    uint32_t pos = layout.startPos;
+    bool bOptional = true;                                                      // O-bit set or not yet met
+
+    for (std::size_t idx = 0; idx < layout.count; idx++)
+    {
+        const PduField & field = layout.fields[idx];
+
+        bool bPresent = true;
+        if (field.condField != FIELD_NO_COND)
+        {
+            const PduFieldValue & cond = values[field.condField];
+            bPresent = cond.bPresent && (cond.value == field.condValue);
+        }
+
+        if (bPresent && (field.kind == FIELD_TYPE2))
+        {
+            bPresent = bOptional && pdu.getValue(pos, 1);                       // P-bit is only sent when O-bit is set
+            pos += bOptional ? 1 : 0;
+        }
+
+        values[idx].bPresent = bPresent;
+        values[idx].value    = 0;
+
+        if (field.kind == FIELD_MBIT)
+        {
+            values[idx].bPresent = bOptional;                                   // M-bit is only sent when O-bit is set
+            values[idx].value    = bOptional ? pdu.getValue(pos, 1) : 0;
+        }
+        else if (bPresent)
+        {
+            values[idx].value = pdu.getValue(pos, field.len);
+            pos += field.len;
+
+            if (field.kind == FIELD_OBIT)
+            {
+                bOptional = (values[idx].value != 0);
+            }
+        }
+    }
+
+    return pos;
+}
+
+/**
+ * @brief Decoded PDU layout ends with a set M-bit, type 3/4 elements follow
+ *
+ */
+
+bool Tetra::pduLayoutHasType34(const PduLayout & layout, const PduFieldValue * values)
+{
+    return (layout.count > 0) && (layout.fields[layout.count - 1].kind == FIELD_MBIT) && (values[layout.count - 1].value != 0);
+}
+
+/**
+ * @brief Add present fields of a decoded PDU layout to report, in layout order
+ *
+ * Reserved bits, O-bits, M-bits and fields without name are not reported. Fields
+ * with value names are reported as strings.
+ *
+ */
+
+void Tetra::pduLayoutReport(const PduLayout & layout, const PduFieldValue * values, Report * report)
+{
+    for (std::size_t idx = 0; idx < layout.count; idx++)
+    {
+        const PduField & field = layout.fields[idx];
+
+        if (values[idx].bPresent && (field.name != NULL) && (field.kind != FIELD_RESERVED) && (field.kind != FIELD_OBIT) && (field.kind != FIELD_MBIT))
+        {
+            if (field.valueNames != NULL)
+            {
+                report->add(field.name, std::string(field.valueNames[values[idx].value]));
+            }
+            else
+            {
+                report->add(field.name, values[idx].value);
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+#ifndef PDULAYOUT_H
+#define PDULAYOUT_H
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include "pdu.h"
+#include "report.h"
+
+/**
+ * @defgroup tetra_common Declarative PDU layouts
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Kind of a PDU layout field
+     *
+     */
+
+    enum PduFieldKind {
+        FIELD_TYPE1    = 0,                                                     ///< Mandatory element, always present
+        FIELD_RESERVED = 1,                                                     ///< Mandatory bits skipped, not reported
+        FIELD_OBIT     = 2,                                                     ///< Option bit, following type 2 elements are present only when set
+        FIELD_TYPE2    = 3,                                                     ///< Optional element preceded by its presence bit (P-bit)
+        FIELD_MBIT     = 4                                                      ///< More bit, type 3/4 elements follow when set (last field, only read when O-bit is set)
+    };
+
+    static const int8_t FIELD_NO_COND = -1;                                     ///< Field presence doesn't depend on another field
+
+    /**
+     * @brief One field of a PDU layout
+     *
+     * A field may be conditioned by the value of a previous field of the same layout
+     * (eg. address length selected by its type identifier): it is then present only
+     * when that field is present and its value is condValue.
+     *
+     * A type 1 field may be reported by value name, from a table covering all its
+     * values (eg. "Amendment" / "Detach all and attach").
+     *
+     */
+
+    struct PduField {
+        const char * name;                                                      ///< Report key, NULL when not reported
+        uint8_t kind;                                                           ///< PduFieldKind
+        uint8_t len;                                                            ///< Length in bits, P-bit excluded
+        int8_t  condField;                                                      ///< Index of the field conditioning presence, FIELD_NO_COND if none
+        uint8_t condValue;                                                      ///< Value of condField for this field to be present
+        const char * const * valueNames;                                        ///< Reported names indexed by value, NULL to report the value
+    };
+
+    constexpr PduField fieldType1(const char * name, const uint8_t len)         // mandatory element
+    {
+        return PduField{name, FIELD_TYPE1, len, FIELD_NO_COND, 0, NULL};
+    }
+
+    constexpr PduField fieldReserved(const uint8_t len)                         // reserved bits
+    {
+        return PduField{NULL, FIELD_RESERVED, len, FIELD_NO_COND, 0, NULL};
+    }
+
+    constexpr PduField fieldObit()                                              // option bit
+    {
+        return PduField{NULL, FIELD_OBIT, 1, FIELD_NO_COND, 0, NULL};
+    }
+
+    constexpr PduField fieldType2(const char * name, const uint8_t len)         // optional element with P-bit
+    {
+        return PduField{name, FIELD_TYPE2, len, FIELD_NO_COND, 0, NULL};
+    }
+
+    constexpr PduField fieldIf(const char * name, const uint8_t len, const int8_t condField, const uint8_t condValue) // element present when field condField has value condValue
+    {
+        return PduField{name, FIELD_TYPE1, len, condField, condValue, NULL};
+    }
+
+    template <std::size_t N>
+    constexpr PduField fieldEnum(const char * name, const uint8_t len, const char * const (&valueNames)[N]) // mandatory element reported by value name
+    {
+        return (N == (1u << len)) ? PduField{name, FIELD_TYPE1, len, FIELD_NO_COND, 0, valueNames} : throw std::logic_error("PDU layout value names don't cover all field values");
+    }
+
+    constexpr PduField fieldMbit()                                              // more bit, type 3/4 elements follow
+    {
+        return PduField{NULL, FIELD_MBIT, 1, FIELD_NO_COND, 0, NULL};
+    }
+
+    /**
+     * @brief Layout of a PDU, built at compile time with pduLayout()
+     *
+     * Fields and layouts are declared constexpr, so pduLayout() checks the fields
+     * at compile time.
+     *
+     */
+
+    struct PduLayout {
+        const char * service;                                                   ///< Report service name
+        const char * name;                                                      ///< Report PDU name
+        uint32_t startPos;                                                      ///< Position of first field (after PDU type)
+        const PduField * fields;                                                ///< Fields in transmission order
+        std::size_t count;                                                      ///< Fields count, at most PDU_LAYOUT_MAX_FIELDS
+    };
+
+    /**
+     * @brief Decoded field of a PDU layout
+     *
+     */
+
+    struct PduFieldValue {
+        bool bPresent;                                                          ///< Field is present in PDU
+        uint64_t value;                                                         ///< Field value, 0 when not present
+    };
+
+    static const std::size_t PDU_LAYOUT_MAX_FIELDS = 32;                        ///< Longest layout
+
+    /**
+     * @brief Field is valid: M-bit is the last field, condition is none or a previous
+     *        unconditioned type 1 or type 2 field wide enough to hold condValue
+     *
+     */
+
+    constexpr bool pduFieldValid(const PduField * fields, const std::size_t count, const std::size_t idx)
+    {
+        return ((fields[idx].kind != FIELD_MBIT) || (idx + 1 == count)) &&
+            ((fields[idx].condField == FIELD_NO_COND) ||
+             ((fields[idx].condField >= 0) && ((std::size_t)fields[idx].condField < idx) &&
+              ((fields[fields[idx].condField].kind == FIELD_TYPE1) || (fields[fields[idx].condField].kind == FIELD_TYPE2)) &&
+              (fields[fields[idx].condField].condField == FIELD_NO_COND) &&
+              (fields[idx].condValue < (1u << fields[fields[idx].condField].len))));
+    }
+
+    constexpr bool pduFieldsValid(const PduField * fields, const std::size_t count, const std::size_t idx) // fields idx to count are valid
+    {
+        return (idx >= count) || (pduFieldValid(fields, count, idx) && pduFieldsValid(fields, count, idx + 1));
+    }
+
+    /**
+     * @brief Build a PDU layout from its fields table
+     *
+     * An invalid field throws, which fails compilation of a constexpr layout.
+     *
+     */
+
+    template <std::size_t N>
+    constexpr PduLayout pduLayout(const char * service, const char * name, const uint32_t startPos, const PduField (&fields)[N])
+    {
+        static_assert(N <= PDU_LAYOUT_MAX_FIELDS, "PDU layout has too many fields");
+        return pduFieldsValid(fields, N, 0) ? PduLayout{service, name, startPos, fields, N} : throw std::logic_error("PDU layout has a misplaced M-bit or a field condition not on a previous unconditioned type 1 or type 2 field");
+    }
+
+    uint32_t pduLayoutDecode(const PduLayout & layout, const Pdu & pdu, PduFieldValue * values); // decode all fields in one pass
+    bool pduLayoutHasType34(const PduLayout & layout, const PduFieldValue * values); // M-bit is set
+    void pduLayoutReport(const PduLayout & layout, const PduFieldValue * values, Report * report); // add present fields to report
+
+};
+
+/** @} */
+
+#endif /* PDULAYOUT_H */
@@ -16,6 +16,17 @@ Report::Report(zmq::socket_t *zmqSocket, Tetra::Log * log)
 {
     m_zmqSocket = zmqSocket;
     m_log      = log;
+    m_carrierId = -1;
+}
+
+/**
+ * @brief Set carrier identifier added to every report, -1 to disable
+ *
+ */
+
+void Report::setCarrierId(const int carrierId)
+{
+    m_carrierId = carrierId;
 }
 
 /**
@@ -42,12 +53,17 @@ void Report::start(std::string service, std::string pdu, const TetraTime tetraTi
     
     std::chrono::time_point<std::chrono::system_clock> now = std::chrono::system_clock::now();
     std::time_t currentTime = std::chrono::system_clock::to_time_t(now);
-    std::tm* timeinfo = std::localtime(&currentTime);
+    std::tm timeinfo;
+    localtime_r(&currentTime, &timeinfo);                                       // reentrant, reports may be built from several threads
     std::ostringstream oss;
-    oss << std::put_time(timeinfo, "%Y-%m-%dT%H:%M:%SZ");
+    oss << std::put_time(&timeinfo, "%Y-%m-%dT%H:%M:%SZ");
     std::string timeString = oss.str();
 
     add("time", timeString);
+    if (m_carrierId >= 0)
+    {
+        add("carrier", (uint32_t)m_carrierId);
+    }
     add("service", service);
     add("pdu",     pdu);
 
@@ -113,6 +129,10 @@ void Report::startUPlane(std::string service, std::string pdu, const TetraTime t
 {
     m_jdoc.SetObject();                                                         // create empty Json DOM
 
+    if (m_carrierId >= 0)
+    {
+        add("carrier", (uint32_t)m_carrierId);
+    }
     add("service", service);
     add("pdu",     pdu);
 
@@ -236,7 +256,7 @@ void Report::add(std::string field, double val)
  *
  */
 
-void Report::add(std::string field, Pdu pdu)
+void Report::add(std::string field, const Pdu & pdu)
 {
     std::string txt = pdu.toHex();
 
@@ -316,5 +336,5 @@ void Report::send()
     output += '\n';                                                             // append newline
     m_zmqSocket->send(zmq::buffer(output), zmq::send_flags::none);
     
-    m_log->print(LogLevel::MEDIUM, "%s\n", output.c_str());
+    LOG_PRINT(m_log, LogLevel::MEDIUM, "%s\n", output.c_str());
 }
@@ -41,14 +41,16 @@ namespace Tetra {
         void add(std::string field, uint32_t val);
         void add(std::string field, uint64_t val);
         void add(std::string field, double val);
-        void add(std::string field, Pdu pdu);
+        void add(std::string field, const Pdu & pdu);
         void addArray(std::string name, std::vector<std::tuple<std::string, uint64_t>> & infos);
         void addCompressed(std::string field, const unsigned char * binary_data, uint16_t data_len);
         void send();
+        void setCarrierId(const int carrierId);
 
     private:
         zmq::socket_t *m_zmqSocket;                                                         ///< UDP socket to write to
         Tetra::Log * m_log;                                                     ///< Screen logger
+        int m_carrierId;                                                        ///< Carrier identifier added to reports (-1 if none)
 
         ///< rapidjson document
         rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::CrtAllocator> m_jdoc;
@@ -0,0 +1,133 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @defgroup tetra_common Fixed capacity ring buffer
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Fixed capacity double-mapped ring buffer
+     *
+     * Each element is written twice, at position and at position + N, so
+     * the last len <= N elements pushed are always readable as a contiguous
+     * array without copy. Push is O(1) whatever the window length.
+     *
+     * N must be a power of 2.
+     *
+     */
+
+    template <typename T, std::size_t N>
+    class RingBuffer {
+        static_assert((N & (N - 1)) == 0, "RingBuffer capacity must be a power of 2");
+
+    public:
+        RingBuffer()
+        {
+            for (std::size_t idx = 0; idx < 2 * N; idx++)
+            {
+                m_data[idx] = T();
+            }
+
+            clear();
+            m_writePos = 0;
+        }
+
+        /**
+         * @brief Insert element at buffer end, oldest element is overwritten when full
+         *
+         */
+
+        inline void push(const T val)
+        {
+            m_data[m_writePos]     = val;
+            m_data[m_writePos + N] = val;                                       // mirror
+            m_writePos = (m_writePos + 1) & (N - 1);
+
+            if (m_size < N)
+            {
+                m_size++;
+            }
+        }
+
+        /**
+         * @brief Insert count elements at buffer end
+         *
+         */
+
+        inline void push(const T * vals, std::size_t count)
+        {
+            std::size_t newSize = m_size + count;
+
+            while (count > 0)
+            {
+                std::size_t chunk = N - m_writePos;                             // elements until end of first mapping
+                if (chunk > count)
+                {
+                    chunk = count;
+                }
+
+                std::copy(vals, vals + chunk, &m_data[m_writePos]);
+                std::copy(vals, vals + chunk, &m_data[m_writePos + N]);         // mirror
+
+                m_writePos = (m_writePos + chunk) & (N - 1);
+                vals  += chunk;
+                count -= chunk;
+            }
+
+            m_size = newSize < N ? newSize : N;
+        }
+
+        /**
+         * @brief Return contiguous view of the last len elements pushed (oldest first)
+         *
+         */
+
+        inline const T * window(const std::size_t len) const
+        {
+            return &m_data[(m_writePos + N - len) & (N - 1)];
+        }
+
+        /**
+         * @brief Number of elements pushed since last clear (saturates at capacity)
+         *
+         */
+
+        inline std::size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * @brief Forget buffer content, O(1)
+         *
+         */
+
+        inline void clear()
+        {
+            m_size = 0;
+        }
+
+        static std::size_t capacity()
+        {
+            return N;
+        }
+
+    private:
+        T m_data[2 * N];                                                        ///< Double-mapped storage
+        std::size_t m_writePos;                                                 ///< Next write position [0, N[
+        std::size_t m_size;                                                     ///< Valid elements count
+    };
+
+};
+
+/** @} */
+
+#endif /* RINGBUFFER_H */
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include "scrambling.h"
+
+using namespace Tetra;
+
+/**
+ * @brief Shared cache state, most recently used sequence first
+ *
+ */
+
+struct ScramblingCacheState {
+    std::mutex mutex;
+    std::vector<ScramblingCache::KeystreamPtr> entries;
+};
+
+static ScramblingCacheState & scramblingCacheState()
+{
+    static ScramblingCacheState state;                                          // thread-safe initialization (C++11)
+    return state;
+}
+
+/**
+ * @brief Fibonacci LFSR scrambling sequence generation - 8.2.5
+ *
+ */
+
+void ScramblingCache::generate(const uint32_t scramblingCode, uint8_t * bits, const std::size_t len)
+{
+    const uint8_t poly[14] = {32, 26, 23, 22, 16, 12, 11, 10, 8, 7, 5, 4, 2, 1}; // Feedback polynomial - see 8.2.5.2 (8.39)
+
+    uint32_t lfsr = scramblingCode;                                             // linear feedback shift register initialization (=0 + 3 for BSCH, calculated from Color code ch 19 otherwise)
+    for (std::size_t i = 0; i < len; i++)
+    {
+        uint32_t bit = lfsr >> (32 - poly[0]);                                  // apply poly (Xj + ...)
+        for (int j = 1; j < 14; j++)
+        {
+            bit = bit ^ (lfsr >> (32 - poly[j]));
+        }
+        bit = bit & 1;                                                          // finish apply feedback polynomial (+ 1)
+        lfsr = (lfsr >> 1) | (bit << 31);
+
+        bits[i] = (uint8_t)bit;
+    }
+}
+
+/**
+ * @brief Return scrambling sequence of MAX_LEN bits for scramblingCode, generated on first use
+ *
+ * Sequences last used by the calling thread are found without lock. The returned
+ * sequence is valid until the next call from the same thread.
+ *
+ */
+
+const ScramblingCache::Keystream * ScramblingCache::get(const uint32_t scramblingCode)
+{
+    static thread_local KeystreamPtr tEntries[THREAD_CACHE_SIZE];              // most recently used first
+
+    for (std::size_t idx = 0; idx < THREAD_CACHE_SIZE; idx++)
+    {
+        if (tEntries[idx] && (tEntries[idx]->scramblingCode == scramblingCode))
+        {
+            std::rotate(tEntries, tEntries + idx, tEntries + idx + 1);          // move to front, no reference count change
+            return tEntries[0].get();
+        }
+    }
+
+    std::rotate(tEntries, tEntries + THREAD_CACHE_SIZE - 1, tEntries + THREAD_CACHE_SIZE); // least recently used to front, then replaced
+    tEntries[0] = find(scramblingCode);
+
+    return tEntries[0].get();
+}
+
+/**
+ * @brief Find scrambling sequence in shared cache, generate it on first use
+ *
+ */
+
+ScramblingCache::KeystreamPtr ScramblingCache::find(const uint32_t scramblingCode)
+{
+    ScramblingCacheState & state = scramblingCacheState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (std::size_t idx = 0; idx < state.entries.size(); idx++)
+    {
+        if (state.entries[idx]->scramblingCode == scramblingCode)
+        {
+            std::rotate(state.entries.begin(), state.entries.begin() + idx, state.entries.begin() + idx + 1); // move to front
+            return state.entries[0];
+        }
+    }
+
+    std::shared_ptr<Keystream> keystream = std::make_shared<Keystream>();
+    keystream->scramblingCode = scramblingCode;
+    generate(scramblingCode, keystream->bits, MAX_LEN);
+
+    state.entries.insert(state.entries.begin(), keystream);
+    if (state.entries.size() > CACHE_SIZE)                                      // evict least recently used, still valid for threads holding it
+    {
+        state.entries.pop_back();
+    }
+
+    return state.entries[0];
+}
+
+/**
+ * @brief Cell scrambling code changed: drop previous sequence and prepare the new one
+ *
+ * The synchronisation burst sequence is shared by all cells and never dropped.
+ *
+ */
+
+void ScramblingCache::update(const uint32_t oldScramblingCode, const uint32_t newScramblingCode)
+{
+    if (oldScramblingCode != newScramblingCode && oldScramblingCode != BSCH_CODE)
+    {
+        ScramblingCacheState & state = scramblingCacheState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        for (std::size_t idx = 0; idx < state.entries.size(); idx++)
+        {
+            if (state.entries[idx]->scramblingCode == oldScramblingCode)
+            {
+                state.entries.erase(state.entries.begin() + idx);
+                break;
+            }
+        }
+    }
+
+    find(newScramblingCode);                                                    // generate outside of the decoding path
+}
+
+/**
+ * @brief (De)scramble len hard bits - 8.2.5
+ *
+ * in and out may be the same buffer.
+ *
+ */
+
+void ScramblingCache::scramble(const uint8_t * in, uint8_t * out, const std::size_t len, const uint32_t scramblingCode)
+{
+    if (len > MAX_LEN)                                                          // not a TETRA block, generate the sequence
+    {
+        std::vector<uint8_t> bits(len);
+        generate(scramblingCode, bits.data(), len);
+        for (std::size_t idx = 0; idx < len; idx++)
+        {
+            out[idx] = in[idx] ^ bits[idx];
+        }
+        return;
+    }
+
+    const Keystream * keystream = get(scramblingCode);
+
+    std::size_t idx = 0;
+    for (std::size_t w = 0; w < len / 8; w++, idx += 8)                         // 8 bits per 64-bit word
+    {
+        uint64_t val;
+        std::memcpy(&val, in + idx, 8);
+        val ^= keystream->words[w];
+        std::memcpy(out + idx, &val, 8);
+    }
+    for (; idx < len; idx++)
+    {
+        out[idx] = in[idx] ^ keystream->bits[idx];
+    }
+}
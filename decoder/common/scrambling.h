@@ -0,0 +1,61 @@
+#ifndef SCRAMBLING_H
+#define SCRAMBLING_H
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @defgroup tetra_common Scrambling sequences cache
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Cache of scrambling sequences - 8.2.5
+     *
+     * The scrambling sequence only depends on the scrambling code, every block
+     * restarts the LFSR from it. Sequences are generated once per code and kept
+     * in a small most-recently-used cache shared by all threads, so several cells
+     * can be followed by the same process. Each thread also keeps the sequences it
+     * used last, so the shared cache (and its lock) is only looked up when the
+     * thread meets a new scrambling code.
+     *
+     * Sequences are stored one bit per byte like the rest of the decoder, so
+     * (de)scrambling hard bits is a XOR of 8 bits per 64-bit word.
+     *
+     */
+
+    class ScramblingCache {
+    public:
+        static const std::size_t MAX_LEN           = 432;                       ///< Longest scrambled block (NDB BKN1 + BKN2)
+        static const std::size_t CACHE_SIZE        = 8;                         ///< Scrambling codes kept in cache
+        static const std::size_t THREAD_CACHE_SIZE = 4;                         ///< Scrambling codes kept by each thread (BSCH and cells codes)
+        static const uint32_t BSCH_CODE            = 0x0003;                    ///< Synchronisation burst scrambling code - 8.2.5.2
+
+        struct Keystream {
+            uint32_t scramblingCode;
+            union {
+                uint8_t  bits[MAX_LEN];                                         ///< Scrambling bits, one bit per byte
+                uint64_t words[MAX_LEN / 8];                                    ///< Same bits for word-wide XOR
+            };
+        };
+
+        typedef std::shared_ptr<const Keystream> KeystreamPtr;
+
+        static const Keystream * get(const uint32_t scramblingCode);
+        static void update(const uint32_t oldScramblingCode, const uint32_t newScramblingCode);
+        static void generate(const uint32_t scramblingCode, uint8_t * bits, const std::size_t len);
+        static void scramble(const uint8_t * in, uint8_t * out, const std::size_t len, const uint32_t scramblingCode);
+
+    private:
+        static KeystreamPtr find(const uint32_t scramblingCode);
+    };
+
+};
+
+/** @} */
+
+#endif /* SCRAMBLING_H */
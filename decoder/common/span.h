@@ -0,0 +1,95 @@
+#ifndef SPAN_H
+#define SPAN_H
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @defgroup tetra_common Non-owning view
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Non-owning view of contiguous elements
+     *
+     * Used by channel decoding functions to work on caller buffers (burst,
+     * scratch arena, decoded blocks) without copies nor allocations.
+     * The viewed memory must outlive the span.
+     *
+     */
+
+    template <typename T>
+    class Span {
+    public:
+        Span() : m_data(NULL), m_size(0)
+        {
+        }
+
+        Span(T * data, const std::size_t size) : m_data(data), m_size(size)
+        {
+        }
+
+        template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+        Span(const Span<U> & other) : m_data(other.data()), m_size(other.size()) // non-const to const view
+        {
+        }
+
+        template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+        Span(std::vector<U> & vec) : m_data(vec.data()), m_size(vec.size())
+        {
+        }
+
+        template <typename U, typename = typename std::enable_if<std::is_convertible<const U *, T *>::value>::type>
+        Span(const std::vector<U> & vec) : m_data(vec.data()), m_size(vec.size())
+        {
+        }
+
+        T * data() const
+        {
+            return m_data;
+        }
+
+        std::size_t size() const
+        {
+            return m_size;
+        }
+
+        T & operator[](const std::size_t idx) const
+        {
+            return m_data[idx];
+        }
+
+        T * begin() const
+        {
+            return m_data;
+        }
+
+        T * end() const
+        {
+            return m_data + m_size;
+        }
+
+        /**
+         * @brief View of count elements starting at offset
+         *
+         */
+
+        Span subspan(const std::size_t offset, const std::size_t count) const
+        {
+            return Span(m_data + offset, count);
+        }
+
+    private:
+        T * m_data;                                                             ///< First element
+        std::size_t m_size;                                                     ///< Elements count
+    };
+
+};
+
+/** @} */
+
+#endif /* SPAN_H */
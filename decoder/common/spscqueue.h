@@ -0,0 +1,107 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <utility>
+
+/**
+ * @defgroup tetra_common Bounded lock-free queue
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Bounded single producer / single consumer lock-free queue
+     *
+     * Exactly one thread may call push() and exactly one other thread may
+     * call pop(). Elements are moved in and out of pre-allocated slots, no
+     * allocation is done after construction.
+     *
+     * N must be a power of 2.
+     *
+     */
+
+    template <typename T, std::size_t N>
+    class SpscQueue {
+        static_assert((N & (N - 1)) == 0, "SpscQueue capacity must be a power of 2");
+
+    public:
+        SpscQueue() : m_head(0), m_tail(0)
+        {
+        }
+
+        /**
+         * @brief Move element at queue end (producer side)
+         *
+         * @return false if queue is full, element is left untouched
+         *
+         */
+
+        bool push(T & val)
+        {
+            const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head - m_tail.load(std::memory_order_acquire) >= N)             // full
+            {
+                return false;
+            }
+
+            m_data[head & (N - 1)] = std::move(val);
+            m_head.store(head + 1, std::memory_order_release);                  // publish element to consumer
+
+            return true;
+        }
+
+        /**
+         * @brief Move first element out of queue (consumer side)
+         *
+         * @return false if queue is empty
+         *
+         */
+
+        bool pop(T & val)
+        {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+            if (tail == m_head.load(std::memory_order_acquire))                 // empty
+            {
+                return false;
+            }
+
+            val = std::move(m_data[tail & (N - 1)]);
+            m_tail.store(tail + 1, std::memory_order_release);                  // release slot to producer
+
+            return true;
+        }
+
+        /**
+         * @brief Return elements count, only exact when called from producer or consumer with the other one idle
+         *
+         */
+
+        std::size_t size() const
+        {
+            return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+        }
+
+        std::size_t capacity() const
+        {
+            return N;
+        }
+
+    private:
+        T m_data[N];                                                            ///< Elements slots
+        std::atomic<std::size_t> m_head;                                        ///< Write counter (producer owned)
+        char m_padding[64];                                                     ///< Keep counters on different cache lines
+        std::atomic<std::size_t> m_tail;                                        ///< Read counter (consumer owned)
+    };
+
+};
+
+/** @} */
+
+#endif /* SPSCQUEUE_H */
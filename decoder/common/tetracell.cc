@@ -1,4 +1,5 @@
 #include "tetracell.h"
+#include "scrambling.h"
 
 using namespace Tetra;
 
@@ -50,9 +51,13 @@ void TetraCell::updateScramblingCode(const uint32_t mcc, const uint32_t mnc, con
     uint16_t lmnc        = m_mnc & 0x3fff;                                      // 14 MSB of MNC
     uint16_t lcolor_code = m_colorCode & 0x003f;                                // 6 MSB of ColorCode
 
+    uint32_t previousScramblingCode = m_scramblingCode;
+
     m_scramblingCode = lcolor_code | (lmnc << 6) | (lmcc << 20);                // 30 MSB bits
     m_scramblingCode = (m_scramblingCode << 2) | 0x0003;                        // scrambling initialized to 1 on bits 31-32 - 8.2.5.2 (54)
 
+    ScramblingCache::update(previousScramblingCode, m_scramblingCode);          // invalidate previous scrambling sequence
+
     m_cellInformationsAcquired = true;
 }
 
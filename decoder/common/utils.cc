@@ -27,6 +27,25 @@ std::vector<uint8_t> Tetra::vectorExtract(std::vector<uint8_t> source, const uin
     return ret;
 }
 
+/**
+ * @brief Extract uint8_t vector from contiguous uint8_t buffer
+ *
+ * Caller is responsible for pos + length to be inside the buffer
+ *
+ */
+
+std::vector<uint8_t> Tetra::vectorExtract(const uint8_t * source, const uint32_t pos, const int32_t length)
+{
+    std::vector<uint8_t> ret;
+
+    if (length > 0)                                                             // check if invalid length requested
+    {
+        ret.assign(source + pos, source + pos + (uint32_t)length);
+    }
+
+    return ret;
+}
+
 /**
  * @brief Concatenate two uint8_t vectors
  *
@@ -41,6 +60,56 @@ std::vector<uint8_t> Tetra::vectorAppend(std::vector<uint8_t> vec1, std::vector<
     return ret;
 }
 
+/**
+ * @brief Extract soft bits vector from contiguous int8_t buffer
+ *
+ * Caller is responsible for pos + length to be inside the buffer
+ *
+ */
+
+std::vector<int8_t> Tetra::vectorExtract(const int8_t * source, const uint32_t pos, const int32_t length)
+{
+    std::vector<int8_t> ret;
+
+    if (length > 0)                                                             // check if invalid length requested
+    {
+        ret.assign(source + pos, source + pos + (uint32_t)length);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Concatenate two soft bits vectors
+ *
+ */
+
+std::vector<int8_t> Tetra::vectorAppend(std::vector<int8_t> vec1, std::vector<int8_t> vec2)
+{
+    std::vector<int8_t> ret(vec1);
+
+    ret.insert(ret.end(), vec2.begin(), vec2.end());
+
+    return ret;
+}
+
+/**
+ * @brief Convert soft bits to hard bits (positive value is 1, negative value or erasure is 0)
+ *
+ */
+
+std::vector<uint8_t> Tetra::vectorHardDecision(const std::vector<int8_t> & soft)
+{
+    std::vector<uint8_t> ret(soft.size());
+
+    for (std::size_t idx = 0; idx < soft.size(); idx++)
+    {
+        ret[idx] = soft[idx] > 0 ? 1 : 0;
+    }
+
+    return ret;
+}
+
 /**
  * @brief Convert binary vector to text string 0/1
  *
@@ -65,6 +134,23 @@ std::string Tetra::vectorToString(const std::vector<uint8_t> data, const int len
     return res;
 }
 
+/**
+ * @brief Convert binary contiguous buffer to text string 0/1
+ *
+ */
+
+std::string Tetra::vectorToString(const uint8_t * data, const int len)
+{
+    std::string res = "";
+
+    for (int idx = 0; idx < len; idx++)
+    {
+        res += (char)(data[idx] + '0');
+    }
+
+    return res;
+}
+
 /**
  * @brief Convert bool to string (true/false)
  *
@@ -17,8 +17,13 @@
 namespace Tetra {
 
     std::vector<uint8_t> vectorExtract(std::vector<uint8_t> source, const uint32_t pos, const int32_t length); // extract sub-vector
+    std::vector<uint8_t> vectorExtract(const uint8_t * source, const uint32_t pos, const int32_t length);      // extract sub-vector from contiguous view
     std::vector<uint8_t> vectorAppend(std::vector<uint8_t> vec1, std::vector<uint8_t> vec2);                   // concatenate vectors
+    std::vector<int8_t>  vectorExtract(const int8_t * source, const uint32_t pos, const int32_t length);       // extract soft bits sub-vector from contiguous view
+    std::vector<int8_t>  vectorAppend(std::vector<int8_t> vec1, std::vector<int8_t> vec2);                     // concatenate soft bits vectors
+    std::vector<uint8_t> vectorHardDecision(const std::vector<int8_t> & soft);                                 // soft bits to hard bits
     std::string vectorToString(const std::vector<uint8_t> data, const int len);
+    std::string vectorToString(const uint8_t * data, const int len);
     std::string boolToString(bool value);
     std::string formatStr(const char * fmt, ...);
     double decodeIntegerTwosComplement(uint32_t data, uint8_t nBits, double mult);
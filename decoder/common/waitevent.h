@@ -0,0 +1,95 @@
+#ifndef WAITEVENT_H
+#define WAITEVENT_H
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * @defgroup tetra_common Wait event for lock-free queues
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Let a thread wait for a condition changed by other threads, eg. a
+     *        lock-free queue that is not empty anymore
+     *
+     * The waiting thread first yields SPIN_COUNT times, then blocks on a
+     * condition variable. Threads changing the condition call notify() after
+     * the change; it only takes the mutex when a thread is blocked, so it is
+     * cheap on the hot path.
+     *
+     */
+
+    class WaitEvent {
+    public:
+        static const uint32_t SPIN_COUNT = 64;                                  ///< Yields before blocking
+
+        WaitEvent() : m_waiters(0)
+        {
+        }
+
+        /**
+         * @brief Wait until ready() returns true
+         *
+         * ready() is called by the waiting thread only, it may act (eg. push
+         * to a queue) and return whether it succeeded.
+         *
+         */
+
+        template <typename Pred>
+        void wait(Pred ready)
+        {
+            for (uint32_t spins = 0; spins < SPIN_COUNT; spins++)
+            {
+                if (ready())
+                {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiters.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);                // waiters count visible before condition is checked again
+
+            while (!ready())
+            {
+                m_cond.wait(lock);
+            }
+
+            m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Wake up waiting thread, to be called after changing the condition
+         *
+         */
+
+        void notify()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);                // condition change visible before waiters count is read
+
+            if (m_waiters.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);                      // waiter is either blocked or has not checked the condition yet
+                m_cond.notify_all();
+            }
+        }
+
+    private:
+        std::atomic<uint32_t> m_waiters;                                        ///< Threads blocked or about to block
+        std::mutex m_mutex;                                                     ///< Protects the check then block sequence of waiters
+        std::condition_variable m_cond;                                         ///< Signalled by notify()
+    };
+
+};
+
+/** @} */
+
+#endif /* WAITEVENT_H */
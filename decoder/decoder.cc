@@ -2,18 +2,47 @@
 
 using namespace Tetra;
 
+/**
+ * @brief Packed byte to 8 unpacked bits lookup table (LSB first), one 64-bits word per byte value
+ *
+ */
+
+static uint64_t gUnpackTable[256];
+
+static bool initUnpackTable()
+{
+    for (uint32_t val = 0; val < 256; val++)
+    {
+        uint8_t bits[8];
+        for (uint8_t idx = 0; idx < 8; idx++)
+        {
+            bits[idx] = (uint8_t)((val >> idx) & 0x01);
+        }
+        memcpy(&gUnpackTable[val], bits, 8);
+    }
+
+    return true;
+}
+
+static const bool gUnpackTableReady = initUnpackTable();
+
 /**
  * @brief Tetra decoder
  *
+ * @param carrierId       Carrier identifier added to JSON reports, -1 for none (single carrier)
+ * @param fecWorkers      FEC worker threads count, 0 to decode bursts synchronously in the caller thread
+ * @param bBlockWhenFull  With FEC workers, wait when pipeline is full instead of dropping bursts
+ *
  */
 
-TetraDecoder::TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const LogLevel logLevel, bool bEnableWiresharkOutput)
+TetraDecoder::TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const LogLevel logLevel, bool bEnableWiresharkOutput, const int carrierId, const int fecWorkers, const bool bBlockWhenFull)
 {
     m_zmqSocket = zmqSocket;
 
     m_log       = new Log(logLevel);
 
     m_report    = new Report(m_zmqSocket, m_log);
+    m_report->setCarrierId(carrierId);
     m_tetraCell = new TetraCell();
 
     m_sds    = new Sds(m_log, m_report);
@@ -34,10 +63,26 @@ TetraDecoder::TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const
 
     m_mac    = new Mac(m_log, m_report, m_tetraCell, m_uPlane, m_llc, m_mle, m_wireMsg, bRemoveFillBits);
 
-    m_frame.clear();
-
-    m_bIsSynchronized = false;
-    m_syncBitCounter  = 0;
+    m_syncState       = SYNC_ACQUISITION;
+    m_bitsSinceBurst  = 0;
+    m_syncMisses      = 0;
+    m_maxSyncMisses   = 50;
+    m_burstsCount     = 0;
+    m_bSoftInput      = false;
+    m_headBits        = 0;
+    m_tailBits        = 0;
+
+    m_fecWorkersCount    = fecWorkers > 0 ? (std::size_t)fecWorkers : 0;
+    m_bBlockWhenFull     = bBlockWhenFull;
+    m_jobSeq             = 0;
+    m_droppedPending     = 0;
+    m_droppedBurstsCount = 0;
+    m_bSkipIdleSlots     = true;
+    m_bStopFec.store(false);
+    m_bStopUpper.store(false);
+    m_scramblingCode.store(m_tetraCell->getScramblingCode());
+
+    pipelineStart();
 }
 
 /**
@@ -47,6 +92,8 @@ TetraDecoder::TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const
 
 TetraDecoder::~TetraDecoder()
 {
+    flushPipeline();                                                             // process remaining bursts
+
     delete m_mac;
     delete m_uPlane;
     delete m_llc;
@@ -64,14 +111,76 @@ TetraDecoder::~TetraDecoder()
 /**
  * @brief Reset the synchronizer
  *
- * Burst was matched, we can reset the synchronizer to allow 50 missing frames (expressed in burst units = 50 * 510 bits)
+ * Burst was matched and has just ended, switch to tracking mode: next burst
+ * boundary is expected FRAME_LEN bits later.
  *
  */
 
 void TetraDecoder::resetSynchronizer()
 {
-    m_bIsSynchronized = true;
-    m_syncBitCounter  = FRAME_LEN * 50;                                         // allow 50 missing frames (in bits unit)
+    m_syncState      = SYNC_TRACKING;
+    m_bitsSinceBurst = 0;
+    m_syncMisses     = 0;
+}
+
+/**
+ * @brief Set consecutive missed bursts count before synchronization is lost (default 50)
+ *
+ */
+
+void TetraDecoder::setMaxSyncMisses(const uint32_t count)
+{
+    m_maxSyncMisses = count > 0 ? count : 1;
+}
+
+/**
+ * @brief Set channel decoding policy, must be called before bursts are received
+ *
+ */
+
+void TetraDecoder::setDecodePolicy(const DecodePolicy & policy)
+{
+    m_bSkipIdleSlots = policy.bSkipIdle;
+    m_mac->setDecodePolicy(policy);
+}
+
+/**
+ * @brief Return bursts count with skipped channel decoding, pipeline must be flushed first
+ *
+ */
+
+DecodeSkipCounters TetraDecoder::getDecodeSkipCounters()
+{
+    return m_mac->getDecodeSkipCounters();
+}
+
+/**
+ * @brief Switch to acquisition mode, burst boundary is searched on every bit
+ *
+ */
+
+void TetraDecoder::enterAcquisition()
+{
+    m_syncState = SYNC_ACQUISITION;
+
+    // restore packed registers from the window, they are not maintained in tracking mode
+    m_tailBits = packBits(m_frame.window(NORMAL_TRAINING_SEQ_3_END_LEN), NORMAL_TRAINING_SEQ_3_END_LEN);
+    m_headBits = packBits(m_frame.window(FRAME_LEN), NORMAL_TRAINING_SEQ_3_BEGIN_LEN);
+}
+
+/**
+ * @brief Check training sequence q at both ends of the burst which ended delay bits ago
+ *
+ */
+
+bool TetraDecoder::burstBoundaryMatch(const std::size_t delay)
+{
+    const uint8_t * frame = m_frame.window(FRAME_LEN + delay);
+
+    uint32_t scoreBegin = (uint32_t)__builtin_popcountll(packBits(frame, NORMAL_TRAINING_SEQ_3_BEGIN_LEN) ^ NORMAL_TRAINING_SEQ_3_BEGIN);
+    uint32_t scoreEnd   = (uint32_t)__builtin_popcountll(packBits(frame + FRAME_LEN - NORMAL_TRAINING_SEQ_3_END_LEN, NORMAL_TRAINING_SEQ_3_END_LEN) ^ NORMAL_TRAINING_SEQ_3_END);
+
+    return (scoreBegin == 0) && (scoreEnd < 2);
 }
 
 /**
@@ -80,6 +189,14 @@ void TetraDecoder::resetSynchronizer()
  * This function is called by "physical layer" when a bit is ready
  * to be processed.
  *
+ * Synchronizer state machine:
+ *   - acquisition: training sequence is searched on every bit, when found
+ *     the burst is processed and synchronizer switches to tracking
+ *   - tracking: only the expected burst boundary +/- SYNC_DRIFT_BITS is
+ *     checked, nearest match first, to follow clock drift. Without match
+ *     the burst is processed at expected boundary anyway, and after
+ *     m_maxSyncMisses consecutive misses synchronizer goes back to acquisition
+ *
  * Note that "frame" is actually called "burst" in Tetra doc
  *
  * @return true if frame (burst) found, false otherwise
@@ -88,54 +205,234 @@ void TetraDecoder::resetSynchronizer()
 
 bool TetraDecoder::rxSymbol(uint8_t sym)
 {
-    m_frame.push_back(sym);                                                     // insert symbol at buffer end
+    m_frame.push(sym);                                                          // insert symbol at buffer end, oldest one is dropped when window is full
+
+    if (m_syncState == SYNC_TRACKING)
+    {
+        m_bitsSinceBurst++;
+
+        if (m_bitsSinceBurst < FRAME_LEN + SYNC_DRIFT_BITS)                     // wait until latest possible boundary is received
+        {
+            return false;
+        }
+
+        for (std::size_t drift = 0; drift <= SYNC_DRIFT_BITS; drift++)          // nearest boundary first, early one before late one
+        {
+            if (burstBoundaryMatch(SYNC_DRIFT_BITS + drift))
+            {
+                processFrame(SYNC_DRIFT_BITS + drift);
+                resetSynchronizer();
+                m_bitsSinceBurst = SYNC_DRIFT_BITS + drift;
+                return true;
+            }
+
+            if ((drift > 0) && burstBoundaryMatch(SYNC_DRIFT_BITS - drift))
+            {
+                processFrame(SYNC_DRIFT_BITS - drift);
+                resetSynchronizer();
+                m_bitsSinceBurst = SYNC_DRIFT_BITS - drift;
+                return true;
+            }
+        }
+
+        // missed burst, process it at the expected boundary
+        processFrame(SYNC_DRIFT_BITS);
+        m_bitsSinceBurst = SYNC_DRIFT_BITS;
+        m_syncMisses++;
+
+        if (m_syncMisses >= m_maxSyncMisses)
+        {
+            // synchronization is lost
+            printf("* synchronization lost\n");
+            enterAcquisition();
+        }
+
+        return false;
+    }
+
+    // slide packed registers over the bit stream: tail register gets the new bit, head register
+    // gets the bit entering position 11 of the burst window
+    m_tailBits = ((m_tailBits << 1) | (sym & 0x01)) & ((1ULL << NORMAL_TRAINING_SEQ_3_END_LEN) - 1);
+    m_headBits = ((m_headBits << 1) | (m_frame.window(FRAME_LEN - NORMAL_TRAINING_SEQ_3_BEGIN_LEN + 1)[0] & 0x01)) & ((1ULL << NORMAL_TRAINING_SEQ_3_BEGIN_LEN) - 1);
 
     if (m_frame.size() < FRAME_LEN)                                             // not enough data to process
     {
-        return 0;
+        return false;
     }
 
-    bool frameFound = false;
-    uint32_t scoreBegin = patternAtPositionScore(m_frame, NORMAL_TRAINING_SEQ_3_BEGIN, 0);
-    uint32_t scoreEnd   = patternAtPositionScore(m_frame, NORMAL_TRAINING_SEQ_3_END, 500);
+    uint32_t scoreBegin = (uint32_t)__builtin_popcountll(m_headBits ^ NORMAL_TRAINING_SEQ_3_BEGIN);
+    uint32_t scoreEnd   = (uint32_t)__builtin_popcountll(m_tailBits ^ NORMAL_TRAINING_SEQ_3_END);
 
     if ((scoreBegin == 0) && (scoreEnd < 2))                                    // frame (burst) is matched and can be processed
     {
-        frameFound = true;
-        resetSynchronizer();                                                    // reset missing sync synchronizer
+        processFrame();
+        resetSynchronizer();                                                    // switch to tracking
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Process a block of received symbols
+ *
+ * Equivalent to calling rxSymbol() for each bit of the block.
+ *
+ * @param data     Received data
+ * @param len      Data length in bytes
+ * @param bPacked  Data are packed (1 byte = 8 bits, LSB first), otherwise 1 byte = 1 bit
+ *
+ * @return Number of frames (bursts) found
+ *
+ */
+
+uint32_t TetraDecoder::rxSymbols(const uint8_t * data, const std::size_t len, const bool bPacked)
+{
+    if (!bPacked)
+    {
+        return rxBits(data, len);
     }
 
-    bool clearedFlag = false;
+    const std::size_t CHUNK_LEN = 128;                                          // unpack by chunks of 128 bytes = 1024 bits
+    uint8_t bits[CHUNK_LEN * 8];
+    uint32_t framesCount = 0;
+
+    (void)gUnpackTableReady;
 
-    if (frameFound || (m_bIsSynchronized && ((m_syncBitCounter % 510) == 0)))   // the frame can be processed either by presence of training sequence, either by synchronised and still allowed missing frames
+    for (std::size_t pos = 0; pos < len; pos += CHUNK_LEN)
     {
-        m_mac->incrementTn();
-        processFrame();
+        std::size_t count = len - pos < CHUNK_LEN ? len - pos : CHUNK_LEN;
+
+        for (std::size_t idx = 0; idx < count; idx++)
+        {
+            memcpy(&bits[idx * 8], &gUnpackTable[data[pos + idx]], 8);
+        }
+
+        framesCount += rxBits(bits, count * 8);
+    }
+
+    return framesCount;
+}
 
-        // frame has been processed, so clear it
-        m_frame.clear();
+/**
+ * @brief Process a block of received soft symbols
+ *
+ * Soft bit is int8 value: positive is 1, negative is 0, magnitude is the
+ * confidence and 0 is an erasure. Burst synchronisation uses the hard
+ * decisions, lower MAC decoding uses the soft values.
+ *
+ * @return Number of frames (bursts) found
+ *
+ */
+
+uint32_t TetraDecoder::rxSoftSymbols(const int8_t * data, const std::size_t len)
+{
+    const std::size_t CHUNK_LEN = 1024;
+    uint8_t bits[CHUNK_LEN];
+    uint32_t framesCount = 0;
 
-        // set flag to prevent erasing first bit in frame
-        clearedFlag = true;
+    m_bSoftInput = true;
+
+    for (std::size_t pos = 0; pos < len; pos += CHUNK_LEN)
+    {
+        std::size_t count = len - pos < CHUNK_LEN ? len - pos : CHUNK_LEN;
+
+        for (std::size_t idx = 0; idx < count; idx++)
+        {
+            bits[idx] = data[pos + idx] > 0 ? 1 : 0;
+        }
+
+        framesCount += rxBits(bits, count, data + pos);
     }
 
-    m_syncBitCounter--;
+    return framesCount;
+}
+
+/**
+ * @brief Process a block of unpacked bits
+ *
+ * While the burst window is filling up (acquisition) or before the next expected
+ * burst boundary (tracking), no burst can be found, so bits are copied in bulk.
+ *
+ * @return Number of frames (bursts) found
+ *
+ */
+
+uint32_t TetraDecoder::rxBits(const uint8_t * bits, const std::size_t len, const int8_t * softBits)
+{
+    uint32_t framesCount = 0;
+    std::size_t idx = 0;
 
-    if (m_syncBitCounter <= 0)
+    while (idx < len)
     {
-        // synchronization is lost
-        printf("* synchronization lost\n");
-        m_bIsSynchronized  = false;
-        m_syncBitCounter = 0;
+        std::size_t count = bitsBeforeCheck();
+
+        if (count > 0)                                                          // bulk phase, no burst can be found
+        {
+            if (count > len - idx)
+            {
+                count = len - idx;
+            }
+
+            m_frame.push(bits + idx, count);
+            if (softBits != NULL)
+            {
+                m_softFrame.push(softBits + idx, count);
+            }
+            idx += count;
+
+            if (m_syncState == SYNC_TRACKING)
+            {
+                m_bitsSinceBurst += count;
+            }
+            else
+            {
+                // restore packed registers from the window
+                m_tailBits = packBits(m_frame.window(NORMAL_TRAINING_SEQ_3_END_LEN), NORMAL_TRAINING_SEQ_3_END_LEN);
+                m_headBits = packBits(m_frame.window(FRAME_LEN), NORMAL_TRAINING_SEQ_3_BEGIN_LEN);
+            }
+        }
+        else
+        {
+            if (softBits != NULL)
+            {
+                m_softFrame.push(softBits[idx]);                                // soft window must be up to date before frame is processed
+            }
+
+            if (rxSymbol(bits[idx]))
+            {
+                framesCount++;
+            }
+            idx++;
+        }
     }
 
-    if (!clearedFlag)
+    return framesCount;
+}
+
+/**
+ * @brief Return number of bits which can be received before a burst boundary must be checked
+ *
+ */
+
+std::size_t TetraDecoder::bitsBeforeCheck()
+{
+    if (m_syncState == SYNC_TRACKING)
     {
-        // remove first symbol from buffer to make space for next one
-        m_frame.erase(m_frame.begin());
+        return FRAME_LEN + SYNC_DRIFT_BITS - 1 - m_bitsSinceBurst;
     }
 
-    return frameFound;
+    return m_frame.size() + 1 < FRAME_LEN ? FRAME_LEN - 1 - m_frame.size() : 0;
+}
+
+/**
+ * @brief Return number of valid bursts sent to MAC
+ *
+ */
+
+uint64_t TetraDecoder::getBurstsCount()
+{
+    return m_burstsCount;
 }
 
 /**
@@ -145,14 +442,16 @@ bool TetraDecoder::rxSymbol(uint8_t sym)
 
 void TetraDecoder::printData()
 {
+    const uint8_t * frame = m_frame.window(FRAME_LEN);
+
     std::string txt = "";
-    for (int i = 0; i < 12; i++) txt += m_frame[i] == 0 ? "0" : "1";
+    for (int i = 0; i < 12; i++) txt += frame[i] == 0 ? "0" : "1";
 
     txt += " ";
-    for (int i = 12; i < 64; i++) txt += m_frame[i] == 0 ? "0" : "1";
+    for (int i = 12; i < 64; i++) txt += frame[i] == 0 ? "0" : "1";
 
     txt += " ";
-    for (int i = 510 - 11; i < 510; i++) txt += m_frame[i] == 0 ? "0" : "1";
+    for (int i = 510 - 11; i < 510; i++) txt += frame[i] == 0 ? "0" : "1";
 
     printf("%s", txt.c_str());
 }
@@ -160,13 +459,17 @@ void TetraDecoder::printData()
 /**
  * @brief Process frame to decide which type of burst it is then service lower MAC
  *
+ * @param delay  Bits received after the end of the burst
+ *
  */
 
-void TetraDecoder::processFrame()
+void TetraDecoder::processFrame(const std::size_t delay)
 {
-    uint32_t scoreSync    = patternAtPositionScore(m_frame, SYNC_TRAINING_SEQ,     214);
-    uint32_t scoreNormal1 = patternAtPositionScore(m_frame, NORMAL_TRAINING_SEQ_1, 244);
-    uint32_t scoreNormal2 = patternAtPositionScore(m_frame, NORMAL_TRAINING_SEQ_2, 244);
+    const uint8_t * frame = m_frame.window(FRAME_LEN + delay);
+
+    uint32_t scoreSync    = patternAtPositionScore(frame, SYNC_TRAINING_SEQ,     SYNC_TRAINING_SEQ_LEN,   214);
+    uint32_t scoreNormal1 = patternAtPositionScore(frame, NORMAL_TRAINING_SEQ_1, NORMAL_TRAINING_SEQ_LEN, 244);
+    uint32_t scoreNormal2 = patternAtPositionScore(frame, NORMAL_TRAINING_SEQ_2, NORMAL_TRAINING_SEQ_LEN, 244);
 
     // soft decision
     uint32_t scoreMin = scoreSync;
@@ -184,32 +487,306 @@ void TetraDecoder::processFrame()
         burstType = NDB_SF;
     }
 
+    if (m_fecWorkersCount > 0)                                                  // pipeline mode, TDMA time is incremented by upper stage
+    {
+        m_job.bValid         = scoreMin <= 5;
+        m_job.bSoft          = m_bSoftInput;
+        m_job.burstType      = burstType;
+        m_job.scramblingCode = m_scramblingCode.load(std::memory_order_relaxed);
+        memcpy(m_job.data, frame, FRAME_LEN);
+        if (m_bSoftInput)
+        {
+            memcpy(m_job.softData, m_softFrame.window(FRAME_LEN + delay), FRAME_LEN);
+        }
+
+        pipelinePush();
+        return;
+    }
+
+    m_mac->incrementTn();
+
     if (scoreMin <= 5)
     {
         // valid burst found, send it to MAC
-        m_mac->serviceLowerMac(m_frame, burstType);
+        m_burstsCount++;
+        m_mac->serviceLowerMac(frame, burstType, m_bSoftInput ? m_softFrame.window(FRAME_LEN + delay) : NULL);
     }
 }
 
 /**
- * @brief Return pattern/data comparison errors count at position in data vector
+ * @brief Start FEC workers and upper stage threads
+ *
+ * Pipeline stages:
+ *   - sync (caller thread): burst synchronisation and burst type, see processFrame()
+ *   - FEC workers: channel decoding with Mac::decodeBurst(), jobs are dispatched round-robin
+ *   - upper stage: TDMA time, upper MAC and all upper layers (including reports)
  *
- * @param data      Vector to look in from pattern
- * @param pattern   Pattern to search
- * @param position  Position in vector to start search
+ * Each worker has one input and one output SPSC queue. Upper stage reads output
+ * queues in the same round-robin order, so bursts are processed in TDMA order.
+ * A stage waiting for a queue yields a few times then blocks on its WaitEvent,
+ * notified by the stage on the other side of the queue.
  *
- * @return Score based on similarity with pattern (differences count between vector and pattern)
+ */
+
+void TetraDecoder::pipelineStart()
+{
+    if (m_fecWorkersCount == 0)
+    {
+        return;
+    }
+
+    for (std::size_t idx = 0; idx < m_fecWorkersCount; idx++)
+    {
+        m_fecQueues.push_back(new BurstQueue());
+        m_upperQueues.push_back(new BurstQueue());
+        m_fecEvents.push_back(new WaitEvent());
+    }
+
+    for (std::size_t idx = 0; idx < m_fecWorkersCount; idx++)
+    {
+        m_fecThreads.push_back(std::thread(&TetraDecoder::fecWorker, this, idx));
+    }
+
+    m_upperThread = std::thread(&TetraDecoder::upperWorker, this);
+}
+
+/**
+ * @brief Stop pipeline once all pushed bursts have been processed
+ *
+ * Following bursts are decoded synchronously.
+ *
+ */
+
+void TetraDecoder::flushPipeline()
+{
+    if (m_fecWorkersCount == 0)
+    {
+        return;
+    }
+
+    m_bStopFec.store(true);
+    for (std::size_t idx = 0; idx < m_fecThreads.size(); idx++)
+    {
+        m_fecEvents[idx]->notify();
+        m_fecThreads[idx].join();
+    }
+
+    m_bStopUpper.store(true);                                                   // set once all jobs are in upper queues
+    m_upperEvent.notify();
+    m_upperThread.join();
+
+    for (std::size_t idx = 0; idx < m_fecWorkersCount; idx++)
+    {
+        delete m_fecQueues[idx];
+        delete m_upperQueues[idx];
+        delete m_fecEvents[idx];
+    }
+
+    m_fecQueues.clear();
+    m_upperQueues.clear();
+    m_fecEvents.clear();
+    m_fecThreads.clear();
+    m_fecWorkersCount = 0;
+}
+
+/**
+ * @brief Push sync stage job to next FEC worker
+ *
+ * When pipeline is full, either wait or drop the burst. Dropped bursts are
+ * reported to upper stage with the next job so TDMA time stays right.
+ *
+ */
+
+void TetraDecoder::pipelinePush()
+{
+    const std::size_t idx = m_jobSeq % m_fecWorkersCount;
+    BurstQueue * queue    = m_fecQueues[idx];
+    const bool bValid     = m_job.bValid;
+
+    m_job.seq           = m_jobSeq;
+    m_job.droppedBefore = m_droppedPending;
+
+    if (m_bBlockWhenFull)
+    {
+        m_syncEvent.wait([&] { return queue->push(m_job); });
+    }
+    else if (!queue->push(m_job))
+    {
+        m_droppedPending++;
+        m_droppedBurstsCount++;
+        return;
+    }
+
+    m_fecEvents[idx]->notify();
+
+    if (bValid)
+    {
+        m_burstsCount++;
+    }
+
+    m_droppedPending = 0;
+    m_jobSeq++;
+}
+
+/**
+ * @brief FEC worker thread, decode burst blocks with the scrambling code expected by sync stage
+ *
+ * NDB BKN1 is decoded speculatively since traffic or signalling mode is only known by upper stage.
+ * Jobs already queued (up to FEC_BATCH_LEN) are decoded together so their control blocks
+ * share the SIMD lanes of the batch Viterbi decoder.
+ * BKN blocks are not decoded when AACH marks the slot as idle and policy skips idle slots,
+ * upper stage decodes them anyway if they turn out to be needed (eg. on frame 18).
+ *
+ */
+
+void TetraDecoder::fecWorker(const std::size_t idx)
+{
+    std::vector<BurstJob> jobs(FEC_BATCH_LEN);                                  // jobs decoded together
+    const uint8_t * data[FEC_BATCH_LEN];
+    const int8_t  * softData[FEC_BATCH_LEN];
+    DecodedBurst  * decoded[FEC_BATCH_LEN];
+
+    while (true)
+    {
+        const bool bStop = m_bStopFec.load();                                   // read before pop so no pushed job is missed
+
+        std::size_t count = 0;                                                  // take the jobs already queued, without waiting for more
+        while ((count < FEC_BATCH_LEN) && m_fecQueues[idx]->pop(jobs[count]))
+        {
+            count++;
+        }
+
+        if (count > 0)
+        {
+            m_syncEvent.notify();                                               // room for sync stage
+
+            std::size_t busy = 0;                                               // jobs needing BKN blocks decoding
+
+            for (std::size_t cnt = 0; cnt < count; cnt++)
+            {
+                BurstJob & job = jobs[cnt];
+                if (job.bValid)
+                {
+                    const int8_t * soft = job.bSoft ? job.softData : NULL;
+
+                    Mac::decodeBurst(job.data, soft, job.burstType, job.scramblingCode, DECODE_AACH | DECODE_BSCH, &job.decoded);
+                    if (!(m_bSkipIdleSlots && Mac::isIdleAach(job.decoded)))
+                    {
+                        data[busy]     = job.data;
+                        softData[busy] = soft;
+                        decoded[busy]  = &job.decoded;
+                        busy++;
+                    }
+                }
+            }
+
+            Mac::decodeBurstsBlocks(data, softData, DECODE_ALL, decoded, busy); // Viterbi decoding of the control blocks of all jobs at once
+
+            for (std::size_t cnt = 0; cnt < count; cnt++)
+            {
+                BurstJob & job = jobs[cnt];
+                m_fecEvents[idx]->wait([&] { return m_upperQueues[idx]->push(job); });
+                m_upperEvent.notify();
+            }
+        }
+        else if (bStop)
+        {
+            break;
+        }
+        else
+        {
+            m_fecEvents[idx]->wait([&] { return (m_fecQueues[idx]->size() > 0) || m_bStopFec.load(); });
+        }
+    }
+}
+
+/**
+ * @brief Upper stage thread, service MAC with decoded bursts in sequence order
+ *
+ */
+
+void TetraDecoder::upperWorker()
+{
+    BurstJob job;
+    uint64_t seq = 0;
+
+    while (true)
+    {
+        const bool bStop = m_bStopUpper.load();
+
+        const std::size_t idx = seq % m_fecWorkersCount;
+
+        if (m_upperQueues[idx]->pop(job))
+        {
+            m_fecEvents[idx]->notify();                                         // room for FEC worker
+
+            for (uint32_t cnt = 0; cnt < job.droppedBefore; cnt++)
+            {
+                m_mac->incrementTn();
+            }
+
+            m_mac->incrementTn();
+
+            if (job.bValid)
+            {
+                m_mac->serviceDecodedBurst(job.decoded, job.data, job.bSoft ? job.softData : NULL);
+            }
+
+            m_scramblingCode.store(m_tetraCell->getScramblingCode(), std::memory_order_relaxed);
+
+            seq++;
+        }
+        else if (bStop)
+        {
+            break;
+        }
+        else
+        {
+            m_upperEvent.wait([&] { return (m_upperQueues[idx]->size() > 0) || m_bStopUpper.load(); });
+        }
+    }
+}
+
+/**
+ * @brief Return number of bursts dropped because pipeline was full
+ *
+ */
+
+uint64_t TetraDecoder::getDroppedBurstsCount()
+{
+    return m_droppedBurstsCount;
+}
+
+/**
+ * @brief Return pattern/data comparison errors count at position in data
+ *
+ * @param data        Contiguous burst data to look in from pattern
+ * @param pattern     Packed pattern to search (first bit as MSB)
+ * @param patternLen  Pattern length in bits (<= 64)
+ * @param position    Position in data to start search
+ *
+ * @return Score based on similarity with pattern (differences count between data and pattern)
+ *
+ */
+
+uint32_t TetraDecoder::patternAtPositionScore(const uint8_t * data, const uint64_t pattern, const std::size_t patternLen, std::size_t position)
+{
+    return (uint32_t)__builtin_popcountll(packBits(data + position, patternLen) ^ pattern);
+}
+
+/**
+ * @brief Pack len <= 64 bits (one bit per byte) into a word, first bit as MSB
  *
  */
 
-uint32_t TetraDecoder::patternAtPositionScore(std::vector<uint8_t> data, std::vector<uint8_t> pattern, std::size_t position)
+uint64_t TetraDecoder::packBits(const uint8_t * data, const std::size_t len)
 {
-    uint32_t errors = 0;
+    uint64_t res = 0;
 
-    for (std::size_t idx = 0; idx < pattern.size(); idx++)
+    for (std::size_t idx = 0; idx < len; idx++)
     {
-        errors += (uint32_t)(pattern[idx] ^ data[position + idx]);
+        res = (res << 1) | (data[idx] & 0x01);
     }
 
-    return errors;
+    return res;
 }
@@ -1,6 +1,7 @@
 #ifndef DECODER_H
 #define DECODER_H
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <signal.h>
 #include <unistd.h>
@@ -13,6 +14,8 @@
 #include <sys/time.h>
 
 #include <iostream>
+#include <atomic>
+#include <thread>
 #include <zmq.hpp>
 
 #include "common/tetra.h"
@@ -20,6 +23,9 @@
 #include "common/log.h"
 #include "common/pdu.h"
 #include "common/report.h"
+#include "common/ringbuffer.h"
+#include "common/spscqueue.h"
+#include "common/waitevent.h"
 #include "mac/mac.h"
 #include "uplane/uplane.h"
 #include "llc/llc.h"
@@ -52,7 +58,6 @@ namespace Tetra {
      *  - only decode continuous downlink burst channel
      *  - MAC PDU association not handled - see 23.4.2.3
      *  - LLC fragmentation not handled
-     *  - Viterbi codec is handling string, not optimized
      *
      */
 
@@ -67,25 +72,43 @@ namespace Tetra {
 
     class TetraDecoder {
     public:
-        TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const LogLevel logLevel, bool bEnableWiresharkOutput);
+        TetraDecoder(zmq::socket_t *zmqSocket, bool bRemoveFillBits, const LogLevel logLevel, bool bEnableWiresharkOutput, const int carrierId = -1, const int fecWorkers = 0, const bool bBlockWhenFull = true);
         ~TetraDecoder();
 
         void printData();
-        void processFrame();
+        void processFrame(const std::size_t delay = 0);
         void resetSynchronizer();
+        void setMaxSyncMisses(const uint32_t count);
+        void setDecodePolicy(const DecodePolicy & policy);
+        DecodeSkipCounters getDecodeSkipCounters();
         bool rxSymbol(uint8_t sym);
+        uint32_t rxSymbols(const uint8_t * data, const std::size_t len, const bool bPacked);
+        uint32_t rxSoftSymbols(const int8_t * data, const std::size_t len);
+        uint64_t getBurstsCount();
+        uint64_t getDroppedBurstsCount();
+        void flushPipeline();
 
     private:
-        // 9.4.4.3.2 Normal training sequence
-        const std::vector<uint8_t> NORMAL_TRAINING_SEQ_1       = {1,1,0,1,0,0,0,0,1,1,1,0,1,0,0,1,1,1,0,1,0,0}; // n1..n22
-        const std::vector<uint8_t> NORMAL_TRAINING_SEQ_2       = {0,1,1,1,1,0,1,0,0,1,0,0,0,0,1,1,0,1,1,1,1,0}; // p1..p22
-        const std::vector<uint8_t> NORMAL_TRAINING_SEQ_3_BEGIN = {0,0,0,1,1,0,1,0,1,1,0,1};                     // q11..q22
-        const std::vector<uint8_t> NORMAL_TRAINING_SEQ_3_END   = {1,0,1,1,0,1,1,1,0,0};                         // q1..q10
-
-        // 9.4.4.3.4 Synchronisation training sequence
-        const std::vector<uint8_t> SYNC_TRAINING_SEQ = {1,1,0,0,0,0,0,1,1,0,0,1,1,1,0,0,1,1,1,0,1,0,0,1,1,1,0,0,0,0,0,1,1,0,0,1,1,1}; // y1..y38
-
-        uint32_t patternAtPositionScore(std::vector<uint8_t> data, std::vector<uint8_t> pattern, std::size_t position);
+        // 9.4.4.3.2 Normal training sequence, packed with first bit as MSB
+        static const uint64_t NORMAL_TRAINING_SEQ_1       = 0b1101000011101001110100; // n1..n22
+        static const uint64_t NORMAL_TRAINING_SEQ_2       = 0b0111101001000011011110; // p1..p22
+        static const uint64_t NORMAL_TRAINING_SEQ_3_BEGIN = 0b000110101101;           // q11..q22
+        static const uint64_t NORMAL_TRAINING_SEQ_3_END   = 0b1011011100;             // q1..q10
+
+        static const std::size_t NORMAL_TRAINING_SEQ_LEN         = 22;
+        static const std::size_t NORMAL_TRAINING_SEQ_3_BEGIN_LEN = 12;
+        static const std::size_t NORMAL_TRAINING_SEQ_3_END_LEN   = 10;
+
+        // 9.4.4.3.4 Synchronisation training sequence, packed with first bit as MSB
+        static const uint64_t    SYNC_TRAINING_SEQ     = 0b11000001100111001110100111000001100111; // y1..y38
+        static const std::size_t SYNC_TRAINING_SEQ_LEN = 38;
+
+        bool burstBoundaryMatch(const std::size_t delay);
+        std::size_t bitsBeforeCheck();
+        void enterAcquisition();
+        uint32_t patternAtPositionScore(const uint8_t * data, const uint64_t pattern, const std::size_t patternLen, std::size_t position);
+        static uint64_t packBits(const uint8_t * data, const std::size_t len);
+        uint32_t rxBits(const uint8_t * bits, const std::size_t len, const int8_t * softBits = NULL);
 
         zmq::socket_t *m_zmqSocket;                                                 ///< UDP socket to write to
 
@@ -103,12 +126,75 @@ namespace Tetra {
         Sndcp  * m_sndcp;                                                       ///< SNDCP layer
         WireMsg * m_wireMsg;                                                    ///< Wireshark output
 
-        bool m_bIsSynchronized;                                                 ///< True is program is synchronized with burst
-        uint64_t m_syncBitCounter;                                              ///< Synchronization bits counter
+        /**
+         * @brief Burst synchronizer state
+         *
+         */
+
+        enum SyncState {
+            SYNC_ACQUISITION,                                                   ///< Search burst boundary on every bit
+            SYNC_TRACKING                                                       ///< Only check expected burst boundary +/- SYNC_DRIFT_BITS
+        };
+
+        static const std::size_t SYNC_DRIFT_BITS = 2;                           ///< Max burst boundary drift followed in tracking mode (bits)
+
+        SyncState m_syncState;                                                  ///< Synchronizer state
+        std::size_t m_bitsSinceBurst;                                           ///< Bits received since the end of last processed burst (tracking)
+        uint32_t m_syncMisses;                                                  ///< Consecutive bursts without training sequence (tracking)
+        uint32_t m_maxSyncMisses;                                               ///< Synchronization is lost after this count of consecutive misses
+        uint64_t m_headBits;                                                    ///< Packed bits at burst window positions 0..11 (training sequence q11..q22)
+        uint64_t m_tailBits;                                                    ///< Packed bits at burst window positions 500..509 (training sequence q1..q10)
+        uint64_t m_burstsCount;                                                 ///< Valid bursts sent to MAC
 
         // burst data
-        const std::size_t FRAME_LEN = 510;                                      ///< Burst length in bits
-        std::vector<uint8_t> m_frame;                                           ///< Burst data
+        static const std::size_t FRAME_LEN = 510;                               ///< Burst length in bits
+        RingBuffer<uint8_t, 1024> m_frame;                                      ///< Burst data sliding window (capacity >= FRAME_LEN)
+        RingBuffer<int8_t, 1024>  m_softFrame;                                  ///< Burst soft data sliding window, in step with m_frame
+        bool m_bSoftInput;                                                      ///< Soft bits are received
+
+        /**
+         * @brief Burst travelling through the pipeline stages: sync -> FEC worker -> upper MAC
+         *
+         */
+
+        struct BurstJob {
+            uint64_t seq;                                                       ///< Sequence number (TDMA order)
+            uint32_t droppedBefore;                                             ///< Bursts dropped just before this one (queue full), to keep TDMA time
+            bool bValid;                                                        ///< Burst must be sent to MAC, otherwise only time is incremented
+            bool bSoft;                                                         ///< Soft data are valid
+            int burstType;                                                      ///< Burst type found by sync stage
+            uint32_t scramblingCode;                                            ///< Scrambling code expected by sync stage
+            uint8_t data[FRAME_LEN];                                            ///< Burst hard bits
+            int8_t  softData[FRAME_LEN];                                        ///< Burst soft bits
+            DecodedBurst decoded;                                               ///< FEC worker result
+        };
+
+        static const std::size_t PIPELINE_QUEUE_LEN = 256;                      ///< Jobs per queue
+        static const std::size_t FEC_BATCH_LEN = ControlBlockBatch::LANES;      ///< Jobs decoded together by a FEC worker
+        typedef SpscQueue<BurstJob, PIPELINE_QUEUE_LEN> BurstQueue;
+
+        void pipelineStart();
+        void pipelinePush();
+        void fecWorker(const std::size_t idx);
+        void upperWorker();
+
+        std::size_t m_fecWorkersCount;                                          ///< FEC workers count, 0 for synchronous decoding
+        bool m_bBlockWhenFull;                                                  ///< Wait for room when pipeline is full (file input), otherwise drop burst (real time input)
+        std::vector<BurstQueue *> m_fecQueues;                                  ///< Sync stage -> FEC worker queues
+        std::vector<BurstQueue *> m_upperQueues;                                ///< FEC worker -> upper stage queues
+        std::vector<WaitEvent *> m_fecEvents;                                   ///< FEC worker wake-up: job pushed, room in upper queue or stop
+        WaitEvent m_syncEvent;                                                  ///< Sync stage wake-up: room in a FEC worker queue
+        WaitEvent m_upperEvent;                                                 ///< Upper stage wake-up: job pushed or stop
+        std::vector<std::thread> m_fecThreads;                                  ///< FEC worker threads
+        std::thread m_upperThread;                                              ///< Upper MAC and layers thread
+        std::atomic<bool> m_bStopFec;                                           ///< No more jobs for FEC workers
+        std::atomic<bool> m_bStopUpper;                                         ///< No more jobs for upper stage
+        std::atomic<uint32_t> m_scramblingCode;                                 ///< Last scrambling code known by upper stage
+        BurstJob m_job;                                                         ///< Sync stage job being filled
+        uint64_t m_jobSeq;                                                      ///< Next job sequence number
+        uint32_t m_droppedPending;                                              ///< Dropped bursts not yet reported to upper stage
+        uint64_t m_droppedBurstsCount;                                          ///< Total dropped bursts
+        bool m_bSkipIdleSlots;                                                  ///< FEC workers don't decode BKN blocks of idle slots
     };
 
 };
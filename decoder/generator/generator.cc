@@ -0,0 +1,661 @@
+#include <cstdio>
+#include "generator.h"
+
+using namespace Tetra;
+
+// 9.4.4.3.2 Normal training sequence
+static const uint8_t NORMAL_TRAINING_SEQ_1[22]       = {1,1,0,1,0,0,0,0,1,1,1,0,1,0,0,1,1,1,0,1,0,0}; // n1..n22
+static const uint8_t NORMAL_TRAINING_SEQ_2[22]       = {0,1,1,1,1,0,1,0,0,1,0,0,0,0,1,1,0,1,1,1,1,0}; // p1..p22
+static const uint8_t NORMAL_TRAINING_SEQ_3_BEGIN[12] = {0,0,0,1,1,0,1,0,1,1,0,1};                     // q11..q22
+static const uint8_t NORMAL_TRAINING_SEQ_3_END[10]   = {1,0,1,1,0,1,1,1,0,0};                         // q1..q10
+
+// 9.4.4.3.4 Synchronisation training sequence
+static const uint8_t SYNC_TRAINING_SEQ[38] = {1,1,0,0,0,0,0,1,1,0,0,1,1,1,0,0,1,1,1,0,1,0,0,1,1,1,0,0,0,0,0,1,1,0,0,1,1,1}; // y1..y38
+
+static const std::size_t BURST_LEN = 510;                                       // Burst length in bits
+
+/**
+ * @brief Append the len LSB of val to vector, MSB first
+ *
+ */
+
+void Tetra::appendBits(std::vector<uint8_t> & vec, const uint64_t val, const uint8_t len)
+{
+    for (int idx = len - 1; idx >= 0; idx--)
+    {
+        vec.push_back((uint8_t)((val >> idx) & 0x01));
+    }
+}
+
+/**
+ * @brief Constructor
+ *
+ */
+
+BurstGenerator::BurstGenerator(const GeneratorConfig & config)
+{
+    m_config = config;
+
+    m_tetraCell.updateScramblingCode(m_config.mcc, m_config.mnc, m_config.colorCode);
+
+    m_tetraTime.tn = 1;
+    m_tetraTime.fn = 1;
+    m_tetraTime.mn = 1;
+
+    m_random.seed(m_config.seed);
+    m_payloadIndex   = 0;
+    m_callIdentifier = 1;
+}
+
+/**
+ * @brief Destructor
+ *
+ */
+
+BurstGenerator::~BurstGenerator()
+{
+
+}
+
+/**
+ * @brief Return time of the next burst
+ *
+ */
+
+TetraTime BurstGenerator::getTime()
+{
+    return m_tetraTime;
+}
+
+/**
+ * @brief Increment TDMA counter with wrap-up as required
+ *
+ */
+
+void BurstGenerator::incrementTn()
+{
+    m_tetraTime.tn++;
+
+    if (m_tetraTime.tn > 4)
+    {
+        m_tetraTime.fn++;
+        m_tetraTime.tn = 1;
+    }
+
+    if (m_tetraTime.fn > 18)
+    {
+        m_tetraTime.mn++;
+        m_tetraTime.fn = 1;
+    }
+
+    if (m_tetraTime.mn > 60)
+    {
+        m_tetraTime.mn = 1;
+    }
+}
+
+/**
+ * @brief Build the next continuous downlink burst in TDMA order
+ *
+ * Mapping of logical channels see 9.5.1:
+ *   - frame 18: BSCH on SB when (MN+TN) % 4 = 3, BNCH on NDB_SF bkn2 when (MN+TN) % 4 = 1
+ *   - frames 1-17: TCH on traffic timeslots, SCH/F or SCH/HD on other ones
+ *
+ * @return Burst type
+ *
+ */
+
+BurstType BurstGenerator::nextBurst(std::vector<uint8_t> & burst)
+{
+    const uint32_t scramblingCode = m_tetraCell.getScramblingCode();
+    BurstType burstType;
+
+    if (m_tetraTime.fn == 18)                                                   // control frame
+    {
+        std::vector<uint8_t> bbk = encodeAach(pduAccessAssign(0b00, 0));
+
+        if ((m_tetraTime.mn + m_tetraTime.tn) % 4 == 3)                         // BSCH
+        {
+            std::vector<uint8_t> sb   = encodeControlBlock(pduSync(), 120, 11, 0x0003);
+            std::vector<uint8_t> bkn2 = encodeControlBlock(pduSysinfo(), 216, 101, scramblingCode);
+            buildSynchronisationBurst(burst, sb, bbk, bkn2);
+            burstType = SB;
+        }
+        else
+        {
+            std::vector<uint8_t> bkn1 = encodeControlBlock(pduNull(124), 216, 101, scramblingCode);
+            std::vector<uint8_t> bkn2;
+
+            if ((m_tetraTime.mn + m_tetraTime.tn) % 4 == 1)                     // BNCH
+            {
+                bkn2 = encodeControlBlock(pduSysinfo(), 216, 101, scramblingCode);
+            }
+            else
+            {
+                bkn2 = encodeControlBlock(pduNull(124), 216, 101, scramblingCode);
+            }
+            buildNormalBurst(burst, bkn1, bbk, bkn2, true);
+            burstType = NDB_SF;
+        }
+    }
+    else if (m_config.trafficTimeslots & (1 << (m_tetraTime.tn - 1)))           // traffic timeslot, TCH/S is only scrambled
+    {
+        uint8_t usageMarker = (uint8_t)(4 + m_tetraTime.tn);
+        std::vector<uint8_t> bbk = encodeAach(pduAccessAssign(0b01, usageMarker));
+
+        std::vector<uint8_t> tch;
+        for (std::size_t idx = 0; idx < 432; idx++)
+        {
+            tch.push_back((uint8_t)(m_random() & 0x01));
+        }
+        tch = scramble(tch, scramblingCode);
+
+        std::vector<uint8_t> bkn1(tch.begin(), tch.begin() + 216);
+        std::vector<uint8_t> bkn2(tch.begin() + 216, tch.end());
+        buildNormalBurst(burst, bkn1, bbk, bkn2, false);
+        burstType = NDB;
+    }
+    else                                                                        // signalling timeslot
+    {
+        uint32_t payload = PAYLOAD_NULL;
+
+        if (m_config.payloads & PAYLOAD_ALL)                                    // round-robin over requested payloads
+        {
+            do
+            {
+                payload = 1u << (m_payloadIndex++ % 6);
+            } while (!(m_config.payloads & payload));
+        }
+
+        if (payload == PAYLOAD_UNALLOCATED)
+        {
+            std::vector<uint8_t> bbk  = encodeAach(pduAccessAssign(0b01, 0b000000));
+            std::vector<uint8_t> bkn1 = encodeControlBlock(pduNull(124), 216, 101, scramblingCode);
+            std::vector<uint8_t> bkn2 = encodeControlBlock(pduNull(124), 216, 101, scramblingCode);
+            buildNormalBurst(burst, bkn1, bbk, bkn2, true);
+            burstType = NDB_SF;
+        }
+        else
+        {
+            uint8_t usageMarker = 0;
+            std::vector<uint8_t> bbk = encodeAach(pduAccessAssign(0b00, 0));
+            std::vector<uint8_t> sch = encodeControlBlock(pduSignalling(payload, &usageMarker), 432, 103, scramblingCode);
+
+            std::vector<uint8_t> bkn1(sch.begin(), sch.begin() + 216);
+            std::vector<uint8_t> bkn2(sch.begin() + 216, sch.end());
+            buildNormalBurst(burst, bkn1, bbk, bkn2, false);
+            burstType = NDB;
+        }
+    }
+
+    applyBitErrors(burst);
+    incrementTn();
+
+    return burstType;
+}
+
+/**
+ * @brief Flip burst bits with the configured bit error rate
+ *
+ */
+
+void BurstGenerator::applyBitErrors(std::vector<uint8_t> & burst)
+{
+    if (m_config.bitErrorRate <= 0.0)
+    {
+        return;
+    }
+
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (std::size_t idx = 0; idx < burst.size(); idx++)
+    {
+        if (distribution(m_random) < m_config.bitErrorRate)
+        {
+            burst[idx] ^= 0x01;
+        }
+    }
+}
+
+/**
+ * @brief Encode a control channel block: CRC, tail bits, RCPC coding, puncturing, interleaving and scrambling - 8.2
+ *
+ * @param type1            Type-1 bits (K1)
+ * @param K                Type-3 and type-5 block length
+ * @param a                Interleaving parameter
+ * @param scramblingCode   Scrambling code
+ *
+ * @return Type-5 bits
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::encodeControlBlock(const std::vector<uint8_t> & type1, const uint32_t K, const uint32_t a, const uint32_t scramblingCode)
+{
+    std::vector<uint8_t> type2 = appendCrc16Ccitt(type1);                       // 8.2.3.1 (K1 + 16, K1) block code
+    appendBits(type2, 0, 4);                                                    // 4 tail bits
+
+    std::vector<uint8_t> mother(4 * type2.size());
+    m_viterbiCodec1614.encode(type2.data(), type2.size(), mother.data());       // same RCPC mother code 1/4 as the decoder - 8.2.3.1.1
+
+    std::vector<uint8_t> type3 = puncture23(mother, K);
+    std::vector<uint8_t> type4 = interleave(type3, K, a);
+
+    return scramble(type4, scramblingCode);
+}
+
+/**
+ * @brief Encode AACH block: Reed-Muller and scrambling - 8.3.2
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::encodeAach(const std::vector<uint8_t> & type1)
+{
+    return scramble(reedMuller3014Encode(type1), m_tetraCell.getScramblingCode());
+}
+
+/**
+ * @brief Append CRC16 ITU-T X.25 - CCITT to data - 8.2.3.2
+ *
+ * The complemented register is appended so the decoder remainder is 0x1D0F
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::appendCrc16Ccitt(const std::vector<uint8_t> & data)
+{
+    uint16_t crc = Crc::crc16Ccitt(data.data(), data.size());                   // CRC16-CCITT with initial value 0xFFFF
+
+    std::vector<uint8_t> res(data);
+    appendBits(res, (uint16_t)~crc, 16);
+
+    return res;
+}
+
+/**
+ * @brief Puncture with 2/3 rate - 8.2.3.1.3
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::puncture23(const std::vector<uint8_t> & data, const uint32_t len)
+{
+    const uint8_t P[] = {0, 1, 2, 5};                                           // 8.2.3.1.3 - P[1..t]
+    std::vector<uint8_t> res(len, 0);
+
+    uint8_t t = 3;                                                              // 8.2.3.1.3
+    uint8_t period = 8;                                                         // 8.2.3.1.2
+
+    for (uint32_t j = 1; j <= len; j++)
+    {
+        uint32_t i = j;
+        uint32_t k = period * ((i - 1) / t) + P[i - t * ((i - 1) / t)];
+        res[j - 1] = data[k - 1];
+    }
+
+    return res;
+}
+
+/**
+ * @brief (K,a) block interleaver - 8.2.4.1
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::interleave(const std::vector<uint8_t> & data, const uint32_t K, const uint32_t a)
+{
+    std::vector<uint8_t> res(K, 0);
+
+    for (uint32_t idx = 1; idx <= K; idx++)
+    {
+        uint32_t k = 1 + (a * idx) % K;
+        res[k - 1] = data[idx - 1];
+    }
+
+    return res;
+}
+
+/**
+ * @brief Fibonacci LFSR scrambling - 8.2.5
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::scramble(const std::vector<uint8_t> & data, const uint32_t scramblingCode)
+{
+    std::vector<uint8_t> res(data.size());
+
+    ScramblingCache::scramble(data.data(), res.data(), data.size(), scramblingCode);
+
+    return res;
+}
+
+/**
+ * @brief Shortened (30,14) Reed-Muller encoder - 8.2.3.3
+ *
+ * Systematic code: 14 information bits followed by 16 parity bits
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::reedMuller3014Encode(const std::vector<uint8_t> & data)
+{
+    static const uint16_t PARITY[14] = {                                        // parity part of the generator matrix (8.46)
+        0b1001101101100000,
+        0b0010110111100000,
+        0b1111110000100000,
+        0b1110000000111100,
+        0b1001100000111010,
+        0b0101010000110110,
+        0b0010110000101110,
+        0b1111111111011111,
+        0b1000001100111001,
+        0b0100001010110101,
+        0b0010000110101101,
+        0b0001001001110011,
+        0b0000100101101011,
+        0b0000010011100111
+    };
+
+    uint16_t parity = 0;
+    for (std::size_t idx = 0; idx < 14; idx++)
+    {
+        if (data[idx])
+        {
+            parity ^= PARITY[idx];
+        }
+    }
+
+    std::vector<uint8_t> res(data.begin(), data.begin() + 14);
+    appendBits(res, parity, 16);
+
+    return res;
+}
+
+/**
+ * @brief Synchronisation continuous downlink burst - 9.4.4.3.4
+ *
+ */
+
+void BurstGenerator::buildSynchronisationBurst(std::vector<uint8_t> & burst, const std::vector<uint8_t> & sb, const std::vector<uint8_t> & bbk, const std::vector<uint8_t> & bkn2)
+{
+    burst.clear();
+    burst.insert(burst.end(), NORMAL_TRAINING_SEQ_3_BEGIN, NORMAL_TRAINING_SEQ_3_BEGIN + 12);
+    appendBits(burst, 0, 2);                                                    // phase adjustment bits hc
+    appendBits(burst, 0xff, 8);                                                 // frequency correction f1..f8
+    appendBits(burst, 0, 32);                                                   // f9..f72
+    appendBits(burst, 0, 32);
+    appendBits(burst, 0xff, 8);                                                 // f73..f80
+    burst.insert(burst.end(), sb.begin(), sb.end());
+    burst.insert(burst.end(), SYNC_TRAINING_SEQ, SYNC_TRAINING_SEQ + 38);
+    burst.insert(burst.end(), bbk.begin(), bbk.end());
+    burst.insert(burst.end(), bkn2.begin(), bkn2.end());
+    appendBits(burst, 0, 2);                                                    // phase adjustment bits hd
+    burst.insert(burst.end(), NORMAL_TRAINING_SEQ_3_END, NORMAL_TRAINING_SEQ_3_END + 10);
+}
+
+/**
+ * @brief Normal continuous downlink burst - 9.4.4.3.2
+ *
+ * @param bSlotFlag  true when the second half slot is used independently (training sequence 2)
+ *
+ */
+
+void BurstGenerator::buildNormalBurst(std::vector<uint8_t> & burst, const std::vector<uint8_t> & bkn1, const std::vector<uint8_t> & bbk, const std::vector<uint8_t> & bkn2, const bool bSlotFlag)
+{
+    const uint8_t * training = bSlotFlag ? NORMAL_TRAINING_SEQ_2 : NORMAL_TRAINING_SEQ_1;
+
+    burst.clear();
+    burst.insert(burst.end(), NORMAL_TRAINING_SEQ_3_BEGIN, NORMAL_TRAINING_SEQ_3_BEGIN + 12);
+    appendBits(burst, 0, 2);                                                    // phase adjustment bits ha
+    burst.insert(burst.end(), bkn1.begin(), bkn1.end());
+    burst.insert(burst.end(), bbk.begin(), bbk.begin() + 14);
+    burst.insert(burst.end(), training, training + 22);
+    burst.insert(burst.end(), bbk.begin() + 14, bbk.end());
+    burst.insert(burst.end(), bkn2.begin(), bkn2.end());
+    appendBits(burst, 0, 2);                                                    // phase adjustment bits hb
+    burst.insert(burst.end(), NORMAL_TRAINING_SEQ_3_END, NORMAL_TRAINING_SEQ_3_END + 10);
+}
+
+/**
+ * @brief SYNC PDU - see 21.4.4.2 - Table 335 with D-MLE-SYNC TM-SDU (18.4.2.1)
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduSync()
+{
+    std::vector<uint8_t> pdu;
+
+    appendBits(pdu, 0b0011, 4);                                                 // system code
+    appendBits(pdu, m_config.colorCode, 6);
+    appendBits(pdu, m_tetraTime.tn - 1, 2);
+    appendBits(pdu, m_tetraTime.fn, 5);
+    appendBits(pdu, m_tetraTime.mn, 6);
+    appendBits(pdu, 0, 2);                                                      // sharing mode
+    appendBits(pdu, 0, 3);                                                      // TS reserved frames
+    appendBits(pdu, 0, 1);                                                      // U-plane DTX
+    appendBits(pdu, 0, 1);                                                      // frame 18 extension
+    appendBits(pdu, 0, 1);                                                      // reserved
+
+    appendBits(pdu, m_config.mcc, 10);                                          // D-MLE-SYNC
+    appendBits(pdu, m_config.mnc, 14);
+    appendBits(pdu, 0b01, 2);                                                   // neighbour cell broadcast
+    appendBits(pdu, 0b00, 2);                                                   // cell service level
+    appendBits(pdu, 0, 1);                                                      // late entry information
+
+    return pdu;
+}
+
+/**
+ * @brief SYSINFO PDU - see 21.4.4.1 with D-MLE-SYSINFO TM-SDU (18.4.2.2)
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduSysinfo()
+{
+    std::vector<uint8_t> pdu;
+
+    appendBits(pdu, 0b10, 2);                                                   // MAC PDU type (broadcast)
+    appendBits(pdu, 0b00, 2);                                                   // broadcast type (SYSINFO)
+    appendBits(pdu, m_config.mainCarrier, 12);
+    appendBits(pdu, m_config.frequencyBand, 4);
+    appendBits(pdu, 0, 2);                                                      // offset
+    appendBits(pdu, 0, 3);                                                      // duplex spacing
+    appendBits(pdu, 0, 1);                                                      // reverse operation
+    appendBits(pdu, 0, 2);                                                      // number of common secondary control channels
+    appendBits(pdu, 0, 3);                                                      // MS_TXPWR_MAX_CELL
+    appendBits(pdu, 0, 4);                                                      // RXLEV_ACCESS_MIN
+    appendBits(pdu, 0, 4);                                                      // ACCESS_PARAMETER
+    appendBits(pdu, 0, 4);                                                      // RADIO_DOWNLINK_TIMEOUT
+    appendBits(pdu, 1, 1);                                                      // hyperframe / cipher key identifier flag
+    appendBits(pdu, m_tetraTime.mn, 16);                                        // cyclic count of hyperframe
+    appendBits(pdu, 0, 2);                                                      // optional field flag
+    appendBits(pdu, 0, 20);                                                     // option value
+
+    appendBits(pdu, m_config.locationArea, 14);                                 // D-MLE-SYSINFO
+    appendBits(pdu, 0xffff, 16);                                                // subscriber class
+    appendBits(pdu, 0, 12);                                                     // BS service details
+
+    return pdu;
+}
+
+/**
+ * @brief ACCESS-ASSIGN PDU - see 21.4.7
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduAccessAssign(const uint8_t header, const uint8_t field1)
+{
+    std::vector<uint8_t> pdu;
+
+    appendBits(pdu, header, 2);
+    appendBits(pdu, field1, 6);
+    appendBits(pdu, 0, 6);                                                      // field 2
+
+    return pdu;
+}
+
+/**
+ * @brief MAC-RESOURCE NULL PDU padded to len bits - see 21.4.3.1
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduNull(const uint32_t len)
+{
+    std::vector<uint8_t> pdu;
+
+    appendBits(pdu, 0b00, 2);                                                   // MAC PDU type
+    appendBits(pdu, 0, 1);                                                      // fill bit indication
+    appendBits(pdu, 0, 1);                                                      // position of grant
+    appendBits(pdu, 0, 2);                                                      // encryption mode
+    appendBits(pdu, 0, 1);                                                      // random access flag
+    appendBits(pdu, 0b000010, 6);                                               // length: 2 octets
+    appendBits(pdu, 0b000, 3);                                                  // NULL address type
+
+    pdu.resize(len, 0);
+
+    return pdu;
+}
+
+/**
+ * @brief MAC-RESOURCE PDU carrying a TM-SDU, with fill bits, padded to len bits - see 21.4.3.1
+ *
+ * @param usageMarker  address type is SSI + usage marker when not 0, SSI otherwise
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduMacResource(const std::vector<uint8_t> & tmSdu, const uint8_t usageMarker, const uint32_t len)
+{
+    std::vector<uint8_t> header;
+    const uint32_t ssi = 1000 + (m_random() % 16);
+
+    uint32_t headerLen = 43 + (usageMarker ? 6 : 0);
+    uint32_t pduLen    = headerLen + (uint32_t)tmSdu.size();
+    uint32_t octets    = (pduLen + 7) / 8;
+
+    appendBits(header, 0b00, 2);                                                // MAC PDU type
+    appendBits(header, (pduLen % 8) ? 1 : 0, 1);                                // fill bit indication
+    appendBits(header, 0, 1);                                                   // position of grant
+    appendBits(header, 0, 2);                                                   // encryption mode
+    appendBits(header, 0, 1);                                                   // random access flag
+    appendBits(header, octets, 6);                                              // length indication (Y2 = Z2 = 1 octet)
+
+    if (usageMarker)
+    {
+        appendBits(header, 0b110, 3);                                           // SSI + usage marker
+        appendBits(header, ssi, 24);
+        appendBits(header, usageMarker, 6);
+    }
+    else
+    {
+        appendBits(header, 0b001, 3);                                           // SSI
+        appendBits(header, ssi, 24);
+    }
+
+    appendBits(header, 0, 1);                                                   // power control flag
+    appendBits(header, 0, 1);                                                   // slot granting flag
+    appendBits(header, 0, 1);                                                   // channel allocation flag
+
+    std::vector<uint8_t> pdu(header);
+    pdu.insert(pdu.end(), tmSdu.begin(), tmSdu.end());
+
+    if (pduLen % 8)                                                             // 23.4.3.2 fill bits: one 1 then 0 up to octet boundary
+    {
+        pdu.push_back(1);
+        pdu.resize(octets * 8, 0);
+    }
+
+    pdu.resize(len, 0);
+
+    return pdu;
+}
+
+/**
+ * @brief SCH/F signalling PDU: MAC-RESOURCE / BL-UDATA / MLE / CMCE
+ *
+ * @param usageMarker  returns the usage marker assigned by the PDU (0 if none)
+ *
+ */
+
+std::vector<uint8_t> BurstGenerator::pduSignalling(const uint32_t payload, uint8_t * usageMarker)
+{
+    if (payload == PAYLOAD_NULL)
+    {
+        *usageMarker = 0;
+        return pduNull(268);
+    }
+
+    std::vector<uint8_t> sdu;
+    appendBits(sdu, 0b0010, 4);                                                 // LLC BL-UDATA
+    appendBits(sdu, 0b010, 3);                                                  // MLE protocol discriminator CMCE
+
+    uint32_t callingSsi = 2000 + (m_random() % 64);
+    *usageMarker = 0;
+
+    switch (payload)
+    {
+    case PAYLOAD_SETUP:                                                         // D-SETUP 14.7.1.12
+        m_callIdentifier = (uint16_t)((m_callIdentifier + 1) & 0x3fff);
+        *usageMarker = (uint8_t)(4 + m_tetraTime.tn);
+        appendBits(sdu, 0b00111, 5);
+        appendBits(sdu, m_callIdentifier, 14);
+        appendBits(sdu, 0b0011, 4);                                             // call timeout
+        appendBits(sdu, 0, 1);                                                  // hook method selection
+        appendBits(sdu, 1, 1);                                                  // simplex/duplex selection
+        appendBits(sdu, 0b00000000, 8);                                         // basic service information
+        appendBits(sdu, 0b00, 2);                                               // transmission grant
+        appendBits(sdu, 0, 1);                                                  // transmission request permission
+        appendBits(sdu, 0, 4);                                                  // call priority
+        appendBits(sdu, 1, 1);                                                  // option flag
+        appendBits(sdu, 0, 1);                                                  // notification indicator
+        appendBits(sdu, 0, 1);                                                  // temporary address
+        appendBits(sdu, 1, 1);                                                  // calling party
+        appendBits(sdu, 0b01, 2);                                               // calling party type identifier
+        appendBits(sdu, callingSsi, 24);
+        appendBits(sdu, 0, 1);                                                  // more bit
+        break;
+
+    case PAYLOAD_TX_GRANTED:                                                    // D-TX GRANTED 14.7.1.15
+        appendBits(sdu, 0b01011, 5);
+        appendBits(sdu, m_callIdentifier, 14);
+        appendBits(sdu, 0b00, 2);                                               // transmission grant
+        appendBits(sdu, 0, 1);                                                  // transmission request permission
+        appendBits(sdu, 0, 1);                                                  // encryption control
+        appendBits(sdu, 0, 1);                                                  // reserved
+        appendBits(sdu, 1, 1);                                                  // option flag
+        appendBits(sdu, 0, 1);                                                  // notification indicator
+        appendBits(sdu, 1, 1);                                                  // transmitting party
+        appendBits(sdu, 0b01, 2);                                               // transmitting party type identifier
+        appendBits(sdu, callingSsi, 24);
+        appendBits(sdu, 0, 1);                                                  // more bit
+        break;
+
+    case PAYLOAD_RELEASE:                                                       // D-RELEASE 14.7.1.9
+        appendBits(sdu, 0b00110, 5);
+        appendBits(sdu, m_callIdentifier, 14);
+        appendBits(sdu, 0b00001, 5);                                            // disconnect cause
+        appendBits(sdu, 0, 1);                                                  // option flag
+        break;
+
+    case PAYLOAD_SDS:                                                           // D-SDS-DATA 14.7.1.10 with simple text message 29.5.2
+        {
+            char text[32];
+            snprintf(text, sizeof(text), "TETRA-KIT %u/%u/%u", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn);
+            std::string txt(text);
+
+            appendBits(sdu, 0b01111, 5);
+            appendBits(sdu, 0b01, 2);                                           // calling party type identifier
+            appendBits(sdu, callingSsi, 24);
+            appendBits(sdu, 0b11, 2);                                           // short data type identifier
+            appendBits(sdu, 16 + 8 * txt.size(), 11);                           // length indicator
+            appendBits(sdu, 0b00000010, 8);                                     // protocol identifier: simple text messaging
+            appendBits(sdu, 0, 1);                                              // fill bit
+            appendBits(sdu, 0b0000001, 7);                                      // text coding scheme: ISO/IEC 8859-1
+            for (std::size_t idx = 0; idx < txt.size(); idx++)
+            {
+                appendBits(sdu, (uint8_t)txt[idx], 8);
+            }
+            appendBits(sdu, 0, 1);                                              // option flag
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return pduMacResource(sdu, *usageMarker, 268);
+}
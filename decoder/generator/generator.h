@@ -0,0 +1,113 @@
+#ifndef GENERATOR_H
+#define GENERATOR_H
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../common/crc.h"
+#include "../common/tetra.h"
+#include "../common/tetracell.h"
+#include "../common/scrambling.h"
+#include "../mac/viterbicodec.h"
+
+/**
+ * @defgroup tetra_generator TETRA downlink bit-stream generator
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Signalling payloads which can be sent on SCH/F
+     *
+     */
+
+    enum GeneratorPayload {
+        PAYLOAD_NULL        = 0x01,                                             // MAC-RESOURCE NULL PDU
+        PAYLOAD_SETUP       = 0x02,                                             // CMCE D-SETUP with usage marker assignment
+        PAYLOAD_TX_GRANTED  = 0x04,                                             // CMCE D-TX GRANTED
+        PAYLOAD_RELEASE     = 0x08,                                             // CMCE D-RELEASE
+        PAYLOAD_SDS         = 0x10,                                             // CMCE D-SDS-DATA simple text message
+        PAYLOAD_UNALLOCATED = 0x20,                                             // unallocated slot (AACH) with NULL PDUs
+        PAYLOAD_ALL         = 0x3f
+    };
+
+    /**
+     * @brief Generator configuration
+     *
+     */
+
+    struct GeneratorConfig {
+        uint32_t mcc;                                                           ///< Cell MCC
+        uint32_t mnc;                                                           ///< Cell MNC
+        uint16_t colorCode;                                                     ///< Cell color code
+        uint16_t locationArea;                                                  ///< Cell location area
+        uint16_t mainCarrier;                                                   ///< Main carrier number (1 / 25 kHz)
+        uint8_t  frequencyBand;                                                 ///< Frequency band (4 -> 400 MHz)
+        uint8_t  trafficTimeslots;                                              ///< Bit mask of timeslots 1-4 carrying traffic on frames 1-17
+        uint32_t payloads;                                                      ///< Bit mask of GeneratorPayload sent on signalling slots
+        double   bitErrorRate;                                                  ///< Bit error rate applied on the whole burst
+        uint32_t seed;                                                          ///< Random generator seed
+    };
+
+    /**
+     * @brief TETRA downlink continuous burst generator
+     *
+     * Builds valid downlink bursts (SB, NDB, NDB_SF) in TDMA order using
+     * the encoding side of the channel coding chain described in clause 8
+     * and the burst structures of clause 9.4.4.
+     *
+     */
+
+    class BurstGenerator {
+    public:
+        BurstGenerator(const GeneratorConfig & config);
+        ~BurstGenerator();
+
+        BurstType nextBurst(std::vector<uint8_t> & burst);
+        TetraTime getTime();
+
+        // encoding functions per clause 8
+        static std::vector<uint8_t> appendCrc16Ccitt(const std::vector<uint8_t> & data);
+        static std::vector<uint8_t> puncture23(const std::vector<uint8_t> & data, const uint32_t len);
+        static std::vector<uint8_t> interleave(const std::vector<uint8_t> & data, const uint32_t K, const uint32_t a);
+        static std::vector<uint8_t> scramble(const std::vector<uint8_t> & data, const uint32_t scramblingCode);
+        static std::vector<uint8_t> reedMuller3014Encode(const std::vector<uint8_t> & data);
+
+    private:
+        GeneratorConfig m_config;                                               ///< Generator configuration
+        TetraCell  m_tetraCell;                                                 ///< Generated cell (scrambling code)
+        TetraTime  m_tetraTime;                                                 ///< Time of the next burst
+        ViterbiCodec1614 m_viterbiCodec1614;                                    ///< Convolutional encoder
+        std::mt19937 m_random;                                                  ///< Payload and bit errors random generator
+        uint32_t m_payloadIndex;                                                ///< Round-robin index in signalling payloads
+        uint16_t m_callIdentifier;                                              ///< Current call identifier
+
+        void incrementTn();
+        void applyBitErrors(std::vector<uint8_t> & burst);
+
+        std::vector<uint8_t> encodeControlBlock(const std::vector<uint8_t> & type1, const uint32_t K, const uint32_t a, const uint32_t scramblingCode);
+        std::vector<uint8_t> encodeAach(const std::vector<uint8_t> & type1);
+
+        // burst assembly 9.4.4.3
+        void buildSynchronisationBurst(std::vector<uint8_t> & burst, const std::vector<uint8_t> & sb, const std::vector<uint8_t> & bbk, const std::vector<uint8_t> & bkn2);
+        void buildNormalBurst(std::vector<uint8_t> & burst, const std::vector<uint8_t> & bkn1, const std::vector<uint8_t> & bbk, const std::vector<uint8_t> & bkn2, const bool bSlotFlag);
+
+        // PDU builders
+        std::vector<uint8_t> pduSync();
+        std::vector<uint8_t> pduSysinfo();
+        std::vector<uint8_t> pduAccessAssign(const uint8_t header, const uint8_t field1);
+        std::vector<uint8_t> pduMacResource(const std::vector<uint8_t> & tmSdu, const uint8_t usageMarker, const uint32_t len);
+        std::vector<uint8_t> pduNull(const uint32_t len);
+        std::vector<uint8_t> pduSignalling(const uint32_t payload, uint8_t * usageMarker);
+    };
+
+    void appendBits(std::vector<uint8_t> & vec, const uint64_t val, const uint8_t len);
+
+};
+
+/** @} */
+
+#endif /* GENERATOR_H */
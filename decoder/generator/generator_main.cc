@@ -0,0 +1,173 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include <vector>
+
+#include "generator.h"
+
+/**
+ * @brief Generator program entry point
+ *
+ * Writes a synthetic TETRA downlink bit stream (1 bit per byte or packed) to a file
+ * or standard output, in the same format as the physical demodulator output read by
+ * the decoder. Usefull for decoder regressions and benchmarks without radio capture.
+ *
+ * Example: ./tetragen -f 100 -o bits.raw
+ *
+ */
+
+int main(int argc, char * argv[])
+{
+    Tetra::GeneratorConfig config;
+    config.mcc              = 208;
+    config.mnc              = 1;
+    config.colorCode        = 1;
+    config.locationArea     = 1;
+    config.mainCarrier      = 3600;
+    config.frequencyBand    = 4;
+    config.trafficTimeslots = 0;
+    config.payloads         = Tetra::PAYLOAD_ALL;
+    config.bitErrorRate     = 0.0;
+    config.seed             = 1;
+
+    uint32_t multiframes = 10;
+    bool bPacked = false;
+    char outFile[255] = "-";
+
+    int option;
+    while ((option = getopt(argc, argv, "hPc:m:n:l:k:f:b:t:x:s:o:")) != -1)
+    {
+        switch (option)
+        {
+        case 'c':
+            config.colorCode = (uint16_t)atoi(optarg);
+            break;
+
+        case 'm':
+            config.mcc = (uint32_t)atoi(optarg);
+            break;
+
+        case 'n':
+            config.mnc = (uint32_t)atoi(optarg);
+            break;
+
+        case 'l':
+            config.locationArea = (uint16_t)atoi(optarg);
+            break;
+
+        case 'k':
+            config.mainCarrier = (uint16_t)atoi(optarg);
+            break;
+
+        case 'f':
+            multiframes = (uint32_t)atoi(optarg);
+            break;
+
+        case 'b':
+            config.bitErrorRate = atof(optarg);
+            break;
+
+        case 't':
+            config.trafficTimeslots = (uint8_t)(strtoul(optarg, NULL, 0) & 0x0f);
+            break;
+
+        case 'x':
+            config.payloads = (uint32_t)(strtoul(optarg, NULL, 0) & Tetra::PAYLOAD_ALL);
+            break;
+
+        case 's':
+            config.seed = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'o':
+            strncpy(outFile, optarg, sizeof(outFile) - 1);
+            break;
+
+        case 'P':
+            bPacked = true;
+            break;
+
+        case 'h':
+            printf("\nUsage: ./tetragen [OPTIONS]\n\n"
+                   "Options:\n"
+                   "  -m <MCC> [default 208]\n"
+                   "  -n <MNC> [default 1]\n"
+                   "  -c <color code> [default 1]\n"
+                   "  -l <location area> [default 1]\n"
+                   "  -k <main carrier> [default 3600]\n"
+                   "  -f <count> number of multiframes to generate [default 10]\n"
+                   "  -b <BER> bit error rate applied to bursts [default 0.0]\n"
+                   "  -t <mask> timeslots 1-4 carrying traffic, bit 0 = TN 1 [default 0x0]\n"
+                   "  -x <mask> signalling payloads: 0x01 NULL, 0x02 D-SETUP, 0x04 D-TX GRANTED,\n"
+                   "            0x08 D-RELEASE, 0x10 D-SDS-DATA, 0x20 unallocated [default 0x3f]\n"
+                   "  -s <seed> random generator seed [default 1]\n"
+                   "  -o <file> output file, - for stdout [default -]\n"
+                   "  -P pack output data (1 byte = 8 bits)\n"
+                   "  -h print this help\n\n");
+            exit(EXIT_FAILURE);
+            break;
+
+        case '?':
+            printf("unkown option, run ./tetragen -h to list available options\n");
+            exit(EXIT_FAILURE);
+            break;
+        }
+    }
+
+    FILE * fd = stdout;
+    if (strcmp(outFile, "-") != 0)
+    {
+        fd = fopen(outFile, "wb");
+        if (fd == NULL)
+        {
+            fprintf(stderr, "Couldn't open output file %s\n", outFile);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    Tetra::BurstGenerator * generator = new Tetra::BurstGenerator(config);
+
+    std::vector<uint8_t> burst;
+    std::vector<uint8_t> out;
+    const uint64_t burstsCount = (uint64_t)multiframes * 18 * 4;
+    uint8_t packedByte  = 0;
+    uint8_t packedCount = 0;
+
+    for (uint64_t cnt = 0; cnt < burstsCount; cnt++)
+    {
+        generator->nextBurst(burst);
+
+        out.clear();
+        if (bPacked)                                                            // same bit order as decoder -P option: LSB first
+        {
+            for (std::size_t idx = 0; idx < burst.size(); idx++)                // 510 bits are not octet aligned, bits are carried to next burst
+            {
+                packedByte |= (uint8_t)(burst[idx] << packedCount);
+                packedCount++;
+                if (packedCount == 8)
+                {
+                    out.push_back(packedByte);
+                    packedByte  = 0;
+                    packedCount = 0;
+                }
+            }
+        }
+        else
+        {
+            out = burst;
+        }
+
+        fwrite(out.data(), 1, out.size(), fd);
+    }
+
+    if (fd != stdout)
+    {
+        fclose(fd);
+    }
+
+    delete generator;
+
+    return EXIT_SUCCESS;
+}
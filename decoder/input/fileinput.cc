@@ -0,0 +1,118 @@
+#include "fileinput.h"
+
+using namespace Tetra;
+
+/**
+ * @brief Constructor - open file, "-" for standard input
+ *
+ */
+
+FileInput::FileInput(const char * path)
+{
+    m_map    = NULL;
+    m_mapLen = 0;
+    m_mapPos = 0;
+
+    if (strcmp(path, "-") == 0)
+    {
+        m_fd = STDIN_FILENO;
+        m_bCloseFd = false;
+    }
+    else
+    {
+        m_fd = open(path, O_RDONLY);
+        m_bCloseFd = true;
+    }
+
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    struct stat st;
+    if ((fstat(m_fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0))    // regular file can be mapped
+    {
+        void * map = mmap(NULL, (std::size_t)st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+
+        if (map != MAP_FAILED)
+        {
+            m_map    = (uint8_t *)map;
+            m_mapLen = (std::size_t)st.st_size;
+            madvise(m_map, m_mapLen, MADV_SEQUENTIAL);
+        }
+    }
+
+    if (m_map == NULL)
+    {
+        m_buffer.resize(CHUNK_LEN);
+    }
+}
+
+/**
+ * @brief Destructor
+ *
+ */
+
+FileInput::~FileInput()
+{
+    if (m_map != NULL)
+    {
+        munmap(m_map, m_mapLen);
+    }
+
+    if (m_bCloseFd && (m_fd >= 0))
+    {
+        close(m_fd);
+    }
+}
+
+/**
+ * @brief Return true if input is open
+ *
+ */
+
+bool FileInput::isOpen()
+{
+    return m_fd >= 0;
+}
+
+/**
+ * @brief Return true if input is memory-mapped
+ *
+ */
+
+bool FileInput::isMapped()
+{
+    return m_map != NULL;
+}
+
+/**
+ * @brief Return next chunk of data
+ *
+ * @param data  Pointer to chunk, valid until next call
+ *
+ * @return Chunk length, 0 at end of file, -1 on error (errno is set)
+ *
+ */
+
+ssize_t FileInput::read(const uint8_t ** data)
+{
+    if (m_map != NULL)
+    {
+        std::size_t len = m_mapLen - m_mapPos;
+        if (len > CHUNK_LEN)
+        {
+            len = CHUNK_LEN;
+        }
+
+        *data = m_map + m_mapPos;
+        m_mapPos += len;
+
+        return (ssize_t)len;
+    }
+
+    ssize_t len = ::read(m_fd, m_buffer.data(), m_buffer.size());
+    *data = m_buffer.data();
+
+    return len;
+}
@@ -0,0 +1,56 @@
+#ifndef FILEINPUT_H
+#define FILEINPUT_H
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @defgroup tetra_input Decoder input sources
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Bit-stream file or standard input reader
+     *
+     * Regular files are memory-mapped and returned by chunks without copy.
+     * Pipes and standard input (path "-") are read into an internal buffer.
+     *
+     */
+
+    class FileInput {
+    public:
+        FileInput(const char * path);
+        ~FileInput();
+
+        bool isOpen();
+        bool isMapped();
+        ssize_t read(const uint8_t ** data);
+
+        static const std::size_t CHUNK_LEN = 65536;                             ///< Maximum bytes returned by read()
+
+    private:
+        int m_fd;                                                               ///< File descriptor
+        bool m_bCloseFd;                                                        ///< File descriptor is owned (not stdin)
+
+        uint8_t * m_map;                                                        ///< Memory-mapped file, NULL if not mapped
+        std::size_t m_mapLen;                                                   ///< Memory-mapped file length
+        std::size_t m_mapPos;                                                   ///< Current position in mapped file
+
+        std::vector<uint8_t> m_buffer;                                          ///< Read buffer when file is not mapped
+    };
+
+};
+
+/** @} */
+
+#endif /* FILEINPUT_H */
@@ -0,0 +1,244 @@
+#include "udpinput.h"
+
+using namespace Tetra;
+
+/**
+ * @brief Constructor - bind UDP socket on all interfaces
+ *
+ * @param port        UDP port to listen on
+ * @param rcvBufSize  Requested socket receive buffer size in bytes (0 to keep system default)
+ *
+ */
+
+UdpInput::UdpInput(const int port, const int rcvBufSize)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_bDropCounterValid = false;
+    m_lastDropCounter   = 0;
+    m_rcvBufSize        = 0;
+
+    m_buffer.resize((std::size_t)BATCH_LEN * SLOT_LEN);
+
+    for (int idx = 0; idx < BATCH_LEN; idx++)
+    {
+        m_iovecs[idx].iov_base = &m_buffer[(std::size_t)idx * SLOT_LEN];
+        m_iovecs[idx].iov_len  = SLOT_LEN;
+    }
+
+    m_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    if (rcvBufSize > 0)
+    {
+        setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &rcvBufSize, sizeof(rcvBufSize));
+    }
+
+    socklen_t optLen = sizeof(m_rcvBufSize);
+    getsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &m_rcvBufSize, &optLen);
+
+    if ((rcvBufSize > 0) && (m_rcvBufSize < rcvBufSize))                        // kernel doubles the requested value, but caps it to net.core.rmem_max
+    {
+        fprintf(stderr, "UDP receive buffer limited to %d bytes, check net.core.rmem_max\n", m_rcvBufSize);
+    }
+
+    int enable = 1;
+    setsockopt(m_fd, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable));        // ask kernel drop counter with each datagram
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(struct sockaddr_in));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_aton("0.0.0.0", &addr.sin_addr);
+
+    if (bind(m_fd, (struct sockaddr *)&addr, sizeof(struct sockaddr)) < 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+/**
+ * @brief Destructor
+ *
+ */
+
+UdpInput::~UdpInput()
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+    }
+}
+
+/**
+ * @brief Return true if socket is bound
+ *
+ */
+
+bool UdpInput::isOpen()
+{
+    return m_fd >= 0;
+}
+
+/**
+ * @brief Set maximum time receive() waits for a datagram, 0 waits forever
+ *
+ */
+
+void UdpInput::setReceiveTimeout(const int timeoutMs)
+{
+    struct timeval tv;
+    tv.tv_sec  = timeoutMs / 1000;
+    tv.tv_usec = (timeoutMs % 1000) * 1000;
+
+    setsockopt(m_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+/**
+ * @brief Blocking receive of a batch of datagrams
+ *
+ * Waits for at least one datagram, then returns all the datagrams already
+ * queued in socket, up to BATCH_LEN.
+ *
+ * @return Number of datagrams received, 0 on timeout, -1 on error (errno is set)
+ *
+ */
+
+int UdpInput::receive()
+{
+    for (int idx = 0; idx < BATCH_LEN; idx++)
+    {
+        memset(&m_msgs[idx].msg_hdr, 0, sizeof(struct msghdr));
+        m_msgs[idx].msg_hdr.msg_iov        = &m_iovecs[idx];
+        m_msgs[idx].msg_hdr.msg_iovlen     = 1;
+        m_msgs[idx].msg_hdr.msg_control    = m_control[idx];
+        m_msgs[idx].msg_hdr.msg_controllen = sizeof(m_control[idx]);
+        m_msgs[idx].msg_len = 0;
+    }
+
+    int count = recvmmsg(m_fd, m_msgs, BATCH_LEN, MSG_WAITFORONE, NULL);
+
+    if ((count < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))          // timeout
+    {
+        return 0;
+    }
+
+    if (count <= 0)
+    {
+        return count;
+    }
+
+    m_stats.batches++;
+    if (count == BATCH_LEN)
+    {
+        m_stats.fullBatches++;
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        m_stats.datagrams++;
+        m_stats.bytes += m_msgs[idx].msg_len;
+
+        if (m_msgs[idx].msg_hdr.msg_flags & MSG_TRUNC)
+        {
+            m_stats.truncated++;
+        }
+
+        updateDropCounter(&m_msgs[idx].msg_hdr);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Update kernel drop statistics from SO_RXQ_OVFL ancillary data
+ *
+ * The kernel counter is cumulative since socket creation
+ *
+ */
+
+void UdpInput::updateDropCounter(struct msghdr * hdr)
+{
+    for (struct cmsghdr * cmsg = CMSG_FIRSTHDR(hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(hdr, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL))
+        {
+            uint32_t counter;
+            memcpy(&counter, CMSG_DATA(cmsg), sizeof(counter));
+
+            uint32_t delta = m_bDropCounterValid ? counter - m_lastDropCounter : counter;
+            if (delta > 0)
+            {
+                m_stats.kernelDrops += delta;
+                fprintf(stderr, "* UDP input: %u datagrams dropped by kernel\n", delta);
+            }
+
+            m_lastDropCounter   = counter;
+            m_bDropCounterValid = true;
+        }
+    }
+}
+
+/**
+ * @brief Return datagram data in current batch
+ *
+ */
+
+const uint8_t * UdpInput::data(const int idx)
+{
+    return (const uint8_t *)m_iovecs[idx].iov_base;
+}
+
+/**
+ * @brief Return datagram length in current batch (truncated to SLOT_LEN)
+ *
+ */
+
+std::size_t UdpInput::length(const int idx)
+{
+    std::size_t len = m_msgs[idx].msg_len;
+
+    return len < (std::size_t)SLOT_LEN ? len : (std::size_t)SLOT_LEN;
+}
+
+/**
+ * @brief Return actual socket receive buffer size
+ *
+ */
+
+int UdpInput::getReceiveBufferSize()
+{
+    return m_rcvBufSize;
+}
+
+/**
+ * @brief Return statistics
+ *
+ */
+
+UdpInputStats UdpInput::getStats()
+{
+    return m_stats;
+}
+
+/**
+ * @brief Print statistics
+ *
+ */
+
+void UdpInput::printStats(FILE * stream)
+{
+    double avgBatch = m_stats.batches > 0 ? (double)m_stats.datagrams / (double)m_stats.batches : 0.0;
+
+    fprintf(stream, "UDP input: %llu datagrams, %llu bytes, %llu batches (avg %.1f datagrams, %llu full), %llu truncated, %llu dropped by kernel\n",
+            (unsigned long long)m_stats.datagrams,
+            (unsigned long long)m_stats.bytes,
+            (unsigned long long)m_stats.batches,
+            avgBatch,
+            (unsigned long long)m_stats.fullBatches,
+            (unsigned long long)m_stats.truncated,
+            (unsigned long long)m_stats.kernelDrops);
+}
@@ -0,0 +1,84 @@
+#ifndef UDPINPUT_H
+#define UDPINPUT_H
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/**
+ * @defgroup tetra_input Decoder input sources
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief UDP input statistics
+     *
+     */
+
+    struct UdpInputStats {
+        uint64_t datagrams;                                                     ///< Datagrams received
+        uint64_t bytes;                                                         ///< Bytes received
+        uint64_t batches;                                                       ///< recvmmsg() calls returning data
+        uint64_t fullBatches;                                                   ///< Batches which filled all slots (application lagging behind)
+        uint64_t truncated;                                                     ///< Datagrams larger than a slot (data lost)
+        uint64_t kernelDrops;                                                   ///< Datagrams dropped by kernel because socket buffer was full (SO_RXQ_OVFL)
+    };
+
+    /**
+     * @brief Batched UDP receiver
+     *
+     * Receives up to BATCH_LEN datagrams per system call with recvmmsg()
+     * into pre-allocated slots. Socket receive buffer size is configurable
+     * and kernel drop counter is read from SO_RXQ_OVFL ancillary data.
+     *
+     */
+
+    class UdpInput {
+    public:
+        UdpInput(const int port, const int rcvBufSize);
+        ~UdpInput();
+
+        bool isOpen();
+        void setReceiveTimeout(const int timeoutMs);
+        int  receive();
+        const uint8_t * data(const int idx);
+        std::size_t length(const int idx);
+
+        int getReceiveBufferSize();
+        UdpInputStats getStats();
+        void printStats(FILE * stream);
+
+        static const int BATCH_LEN = 64;                                        ///< Maximum datagrams per recvmmsg() call
+        static const int SLOT_LEN  = 4096;                                      ///< Maximum datagram size
+
+    private:
+        int m_fd;                                                               ///< Socket file descriptor
+        int m_rcvBufSize;                                                       ///< Actual socket receive buffer size reported by kernel
+
+        std::vector<uint8_t> m_buffer;                                          ///< Datagram slots BATCH_LEN * SLOT_LEN
+        struct mmsghdr m_msgs[BATCH_LEN];                                       ///< recvmmsg() headers
+        struct iovec   m_iovecs[BATCH_LEN];                                     ///< One iovec per slot
+        uint8_t        m_control[BATCH_LEN][CMSG_SPACE(sizeof(uint32_t))];      ///< Ancillary data per slot (SO_RXQ_OVFL)
+
+        bool     m_bDropCounterValid;                                           ///< Kernel drop counter has been received at least once
+        uint32_t m_lastDropCounter;                                             ///< Last kernel drop counter value
+        UdpInputStats m_stats;                                                  ///< Statistics
+
+        void updateDropCounter(struct msghdr * hdr);
+    };
+
+};
+
+/** @} */
+
+#endif /* UDPINPUT_H */
@@ -12,6 +12,9 @@ using namespace Tetra;
 Llc::Llc(Log * log, Report * report, Mle * mle) : Layer(log, report)
 {
     m_mle = mle;
+
+    m_fcsCount       = 0;
+    m_fcsErrorsCount = 0;
 }
 
 /**
@@ -31,12 +34,12 @@ Llc::~Llc()
  *
  */
 
-void Llc::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Llc::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     // call base class function
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_llc", (macLogicalChannelName(macLogicalChannel)).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_llc", (macLogicalChannelName(macLogicalChannel)).c_str(), pdu.toString().c_str());
 
     if (macLogicalChannel == BSCH)                                              // TM-SDU is directly sent to MLE
     {
@@ -101,17 +104,20 @@ void Llc::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
         txt = "BL-ADATA + FCS";
         pos += 1;                                                               // nr
         pos += 1;                                                               // ns
-        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos  - 32);          // TODO removed FCS for now
+        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos  - 32);          // FCS removed from TL-SDU
+        checkFcs(pdu, pos, txt);
         break;
 
     case 0b0101:                                                                // BL-DATA + FCS
         txt = "BL-DATA + FCS";
-        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos  - 32);          // TODO removed FCS for now
+        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos  - 32);          // FCS removed from TL-SDU
+        checkFcs(pdu, pos, txt);
         break;
 
     case 0b0110:                                                                // BL-UDATA + FCS
         txt = "BL-UDATA + FCS";
-        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos - 32);           // TODO removed FCS for now
+        sdu = Pdu(pdu, pos, (int32_t)pdu.size() - (int32_t)pos - 32);           // FCS removed from TL-SDU
+        checkFcs(pdu, pos, txt);
         break;
 
     case 0b0111:                                                                // BL-ACK + FCS
@@ -311,13 +317,45 @@ void Llc::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
 
     if (bPrint)
     {
-        m_log->print(LogLevel::HIGH, "service_llc : TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
+        LOG_PRINT(m_log, LogLevel::HIGH, "service_llc : TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
     }
 
-    m_log->print(LogLevel::HIGH, "service_llc : TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "service_llc : TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
 
     if (!sdu.isEmpty())                                                         // service MLE
     {
         m_mle->service(sdu, macLogicalChannel, m_tetraTime, m_macAddress);
     }
 }
+
+/**
+ * @brief Check the 32 bits FCS ending the LLC PDU, TL-SDU starts at pos
+ *
+ * Only counted and logged, the TL-SDU is passed to MLE anyway.
+ *
+ */
+
+bool Llc::checkFcs(const Pdu & pdu, const uint32_t pos, const std::string & txt)
+{
+    if (pdu.size() < (std::size_t)pos + 32)                                     // no room for FCS
+    {
+        return false;
+    }
+
+    uint32_t crc = 0xFFFFFFFF;                                                  // TL-SDU + FCS, 64 bits at a time without copy
+    for (std::size_t idx = pos; idx < pdu.size(); idx += 64)
+    {
+        const std::size_t len = (pdu.size() - idx < 64) ? pdu.size() - idx : 64;
+        crc = Crc::crc32(pdu.getValue(idx, (uint8_t)len), len, crc);
+    }
+    bool bValid = (crc == Crc::CRC32_RESIDUE);
+
+    m_fcsCount++;
+    if (!bValid)
+    {
+        m_fcsErrorsCount++;
+        LOG_PRINT(m_log, LogLevel::LOW, "service_llc : TN/FN/MN = %2u/%2u/%2u  %-20s  invalid FCS (%llu / %llu)\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), (unsigned long long)m_fcsErrorsCount, (unsigned long long)m_fcsCount);
+    }
+
+    return bValid;
+}
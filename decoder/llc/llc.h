@@ -1,5 +1,6 @@
 #ifndef LLC_H
 #define LLC_H
+#include "../common/crc.h"
 #include "../common/tetra.h"
 #include "../common/layer.h"
 #include "../common/log.h"
@@ -13,10 +14,14 @@ namespace Tetra {
         Llc(Log * log, Report * report, Mle * mle);
         ~Llc();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
         Mle * m_mle;
+
+        uint64_t m_fcsCount;                                                    ///< LLC PDUs received with FCS
+        uint64_t m_fcsErrorsCount;                                              ///< LLC PDUs received with invalid FCS
+        bool checkFcs(const Pdu & pdu, const uint32_t pos, const std::string & txt);
     };
 
 };
@@ -0,0 +1,121 @@
+#include <atomic>
+#include <cstring>
+#include "broadcastcache.h"
+
+using namespace Tetra;
+
+/**
+ * @brief Cached block and its decoding result
+ *
+ */
+
+struct BroadcastCacheEntry {
+    uint64_t hash;                                                              ///< Hash of block
+    uint32_t len;                                                               ///< Block length, 0 when entry is empty
+    bool     bSoft;                                                             ///< Block is soft bits
+    uint8_t  block[BroadcastCache::MAX_LEN];                                    ///< Descrambled type-5 block
+    uint8_t  decoded[BroadcastCache::MAX_DECODED];                              ///< Decoded block (len * 2 / 3 bits)
+};
+
+static thread_local BroadcastCacheEntry gEntries[BroadcastCache::CACHE_SIZE];  // zero initialized: all entries empty
+
+static std::atomic<uint64_t> gHits(0);
+static std::atomic<uint64_t> gMisses(0);
+
+/**
+ * @brief 64 bits FNV-1a hash of block, 8 bytes per step
+ *
+ */
+
+static uint64_t hashBlock(const uint8_t * block, const std::size_t len, const bool bSoft)
+{
+    uint64_t hash = 0xcbf29ce484222325 ^ (bSoft ? 1 : 0);
+
+    std::size_t idx = 0;
+    for (; idx + 8 <= len; idx += 8)
+    {
+        uint64_t val;
+        std::memcpy(&val, block + idx, 8);
+        hash = (hash ^ val) * 0x100000001b3;
+    }
+    for (; idx < len; idx++)
+    {
+        hash = (hash ^ block[idx]) * 0x100000001b3;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+/**
+ * @brief Entry where block is (or would be) stored
+ *
+ */
+
+static BroadcastCacheEntry * entryOf(const uint64_t hash)
+{
+    return &gEntries[hash % BroadcastCache::CACHE_SIZE];
+}
+
+/**
+ * @brief Look for block in cache of calling thread
+ *
+ * @param block    Descrambled type-5 block, hard bits or soft bits
+ * @param len      Block length (at most MAX_LEN)
+ * @param bSoft    Block is soft bits
+ * @param decoded  Decoded block (len * 2 / 3 bits) when found
+ *
+ * @return true when found
+ *
+ */
+
+bool BroadcastCache::find(const uint8_t * block, const std::size_t len, const bool bSoft, uint8_t * decoded)
+{
+    const uint64_t hash = hashBlock(block, len, bSoft);
+    const BroadcastCacheEntry * entry = entryOf(hash);
+
+    if ((entry->hash == hash) && (entry->len == len) && (entry->bSoft == bSoft) && (std::memcmp(entry->block, block, len) == 0))
+    {
+        std::memcpy(decoded, entry->decoded, len * 2 / 3);
+        gHits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    gMisses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+/**
+ * @brief Store block and its decoding result (valid CRC) in cache of calling thread, replacing the previous entry
+ *
+ */
+
+void BroadcastCache::store(const uint8_t * block, const std::size_t len, const bool bSoft, const uint8_t * decoded)
+{
+    if (len > MAX_LEN)
+    {
+        return;
+    }
+
+    const uint64_t hash = hashBlock(block, len, bSoft);
+    BroadcastCacheEntry * entry = entryOf(hash);
+
+    entry->hash  = hash;
+    entry->len   = (uint32_t)len;
+    entry->bSoft = bSoft;
+    std::memcpy(entry->block, block, len);
+    std::memcpy(entry->decoded, decoded, len * 2 / 3);
+}
+
+/**
+ * @brief Hits and misses of all threads
+ *
+ */
+
+BroadcastCache::Stats BroadcastCache::getStats()
+{
+    Stats stats;
+    stats.hits   = gHits.load(std::memory_order_relaxed);
+    stats.misses = gMisses.load(std::memory_order_relaxed);
+
+    return stats;
+}
@@ -0,0 +1,50 @@
+#ifndef BROADCASTCACHE_H
+#define BROADCASTCACHE_H
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @defgroup tetra_mac Broadcast blocks decoding cache
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Cache of decoded broadcast blocks (BSCH and BNCH of synchronisation bursts)
+     *
+     * On a stable cell broadcast blocks are sent again and again with the same content:
+     * SYSINFO on every synchronisation burst, SYNC once per hyperframe since it carries
+     * the multiframe number. When the descrambled received block (hard or soft bits) is
+     * exactly the same as a recent one, the Viterbi decoding result is reused.
+     *
+     * Only blocks with a valid CRC are stored. Entries are kept per thread (FEC workers
+     * don't share them), direct-mapped by a hash of the block and checked byte by byte,
+     * so a hit always gives the same result as decoding the block. Statistics are shared
+     * by all threads.
+     *
+     */
+
+    class BroadcastCache {
+    public:
+        static const std::size_t MAX_LEN     = 216;                             ///< Longest cached type-5 block (BNCH)
+        static const std::size_t MAX_DECODED = MAX_LEN * 2 / 3;                 ///< Longest decoded block (type-2 bits + tail bits)
+        static const std::size_t CACHE_SIZE  = 128;                             ///< Entries per thread, more than one hyperframe of SYNC blocks
+
+        struct Stats {
+            uint64_t hits;                                                      ///< Blocks found in cache, not decoded
+            uint64_t misses;                                                    ///< Blocks not found in cache, decoded
+        };
+
+        static bool find(const uint8_t * block, const std::size_t len, const bool bSoft, uint8_t * decoded);
+        static void store(const uint8_t * block, const std::size_t len, const bool bSoft, const uint8_t * decoded);
+        static Stats getStats();
+    };
+
+};
+
+/** @} */
+
+#endif /* BROADCASTCACHE_H */
@@ -20,250 +20,703 @@
 
 using namespace Tetra;
 
+/**
+ * @brief Branch outputs of the RCPC 16-state mother code of rate 1/4 - 8.2.3.1.1
+ *
+ * Indexed by register r = (u << 4) | state, where state = u(t-1) u(t-2) u(t-3) u(t-4)
+ * from MSB to LSB. Output bits of G1..G4 from MSB to LSB.
+ * Built once at program start and shared by all decoders.
+ *
+ */
+
+struct ViterbiOutputs1614 {
+    uint8_t val[32];
+
+    ViterbiOutputs1614()
+    {
+        const uint8_t POLY[4] = {0b10011, 0b11101, 0b10111, 0b11011};           // G1..G4 - bit d is coefficient of D^d
+
+        for (uint8_t reg = 0; reg < 32; reg++)
+        {
+            val[reg] = 0;
+            for (uint8_t j = 0; j < 4; j++)
+            {
+                uint8_t parity = 0;
+                for (uint8_t d = 0; d <= 4; d++)
+                {
+                    parity ^= ((POLY[j] >> d) & 1) & ((reg >> (4 - d)) & 1);
+                }
+                val[reg] |= (uint8_t)(parity << (3 - j));
+            }
+        }
+    }
+};
+
+static const ViterbiOutputs1614 gViterbiOutputs1614;
+
 
 /**
  * @brief Fibonacci LFSR descrambling - 8.2.5
  *
+ * res size bits of data are descrambled, data and res may be the same buffer.
+ *
  */
 
-std::vector<uint8_t> Mac::descramble(std::vector<uint8_t> data, const int len, const uint32_t scramblingCode)
+void Mac::descramble(Span<const uint8_t> data, Span<uint8_t> res, const uint32_t scramblingCode)
 {
-    const uint8_t poly[14] = {32, 26, 23, 22, 16, 12, 11, 10, 8, 7, 5, 4, 2, 1}; // Feedback polynomial - see 8.2.5.2 (8.39)
+    ScramblingCache::scramble(data.data(), res.data(), res.size(), scramblingCode); // cached scrambling sequence (=0 + 3 for BSCH, calculated from Color code ch 19 otherwise)
+}
+
+/**
+ * @brief Fused (K,a) deinterleaving and 2/3 depuncturing positions - 8.2.4 and 8.2.3.1.3
+ *
+ * dst[i] is the mother code position (0-based) of the i-th received type-5 bit
+ * after deinterleaving and depuncturing. Built once at program start for the
+ * (K,a) pairs used by control channels and shared by all decoders.
+ *
+ */
 
-    std::vector<uint8_t> res;
+struct DeinterleaveDepuncture23Table {
+    uint32_t K;                                                                 // block size (type-3 bits)
+    uint32_t a;                                                                 // interleaving parameter
+    uint32_t len;                                                               // mother code size = 4 * K * 2 / 3
+    std::vector<uint16_t> dst;                                                  // received bit index -> mother code position
 
-    uint32_t lfsr = scramblingCode;                                             // linear feedback shift register initialization (=0 + 3 for BSCH, calculated from Color code ch 19 otherwise)
-    for (int i = 0; i < len; i++)
+    DeinterleaveDepuncture23Table(const uint32_t k, const uint32_t interleave) : K(k), a(interleave), len(4 * k * 2 / 3), dst(k, 0)
     {
-        uint32_t bit = lfsr >> (32 - poly[0]);                                  // apply poly (Xj + ...)
-        for (int j = 1; j < 14; j++)
+        const uint8_t P[] = {0, 1, 2, 5};                                       // 8.2.3.1.3 - P[1..t]
+        const uint32_t t = 3;                                                   // 8.2.3.1.3
+        const uint32_t period = 8;                                              // 8.2.3.1.2
+
+        for (uint32_t j = 1; j <= K; j++)
         {
-            bit = bit ^ (lfsr >> (32 - poly[j]));
+            uint32_t pos = period * ((j - 1) / t) + P[j - t * ((j - 1) / t)];   // depuncture: res[pos - 1] = deinterleaved[j - 1]
+            dst[(a * j) % K] = (uint16_t)(pos - 1);                             // deinterleave: deinterleaved[j - 1] = data[(a * j) % K]
         }
-        bit = bit & 1;                                                          // finish apply feedback polynomial (+ 1)
-        lfsr = (lfsr >> 1) | (bit << 31);
+    }
+};
 
-        res.push_back(data[i] ^ (bit & 0xff));
+static const DeinterleaveDepuncture23Table gDeinterleaveDepuncture23Tables[] = {
+    DeinterleaveDepuncture23Table(120, 11),                                     // BSCH
+    DeinterleaveDepuncture23Table(216, 101),                                    // SCH/HD, BNCH, STCH
+    DeinterleaveDepuncture23Table(432, 103)                                     // SCH/F
+};
+
+static const DeinterleaveDepuncture23Table * deinterleaveDepuncture23Table(const uint32_t K, const uint32_t a)
+{
+    for (const DeinterleaveDepuncture23Table & table : gDeinterleaveDepuncture23Tables)
+    {
+        if (table.K == K && table.a == a)
+        {
+            return &table;
+        }
     }
 
-    return res;
+    return NULL;
 }
 
 /**
- * @brief (K,a) block deinterleaver - 8.2.4
+ * @brief Deinterleave (K,a) and depuncture with 2/3 rate in a single pass - 8.2.4 and 8.2.3.1.3
+ *
+ * Erased bits are set to erasure value. Tabulated (K,a) pairs need no division,
+ * other ones compute positions on the fly.
  *
  */
 
-std::vector<uint8_t> Mac::deinterleave(std::vector<uint8_t> data, const uint32_t K, const uint32_t a)
+template <typename T>
+static void deinterleaveDepuncture23Block(Span<const T> data, const uint32_t K, const uint32_t a, const T erasure, Span<T> res)
 {
-    std::vector<uint8_t> res(K, 0);                                             // output vector is size K
+    const uint32_t len = 4 * K * 2 / 3;                                         // 8.2.3.1.2
+    std::fill(res.begin(), res.begin() + len, erasure);
+
+    const DeinterleaveDepuncture23Table * table = deinterleaveDepuncture23Table(K, a);
+    if (table != NULL)
+    {
+        const uint16_t * dst = table->dst.data();
 
-    for (unsigned int idx = 1; idx <= K; idx++)
+        for (uint32_t idx = 0; idx < K; idx++)
+        {
+            res[dst[idx]] = data[idx];
+        }
+    }
+    else
     {
-        uint32_t k = 1 + (a * idx) % K;
-        res[idx - 1] = data[k - 1];                                             // to interleave: DataOut[i-1] = DataIn[k-1]
+        const uint8_t P[] = {0, 1, 2, 5};                                       // 8.2.3.1.3 - P[1..t]
+        const uint32_t t = 3;                                                   // 8.2.3.1.3
+        const uint32_t period = 8;                                              // 8.2.3.1.2
+
+        for (uint32_t j = 1; j <= K; j++)
+        {
+            uint32_t pos = period * ((j - 1) / t) + P[j - t * ((j - 1) / t)];
+            res[pos - 1] = data[(a * j) % K];
+        }
     }
+}
 
-    return res;
+/**
+ * @brief Deinterleave (K,a) and depuncture with 2/3 rate - 8.2.4 and 8.2.3.1.3
+ *
+ * res must hold 4 * K * 2 / 3 bits, erased bits are set to flag 2 for Viterbi routine.
+ *
+ */
+
+void Mac::deinterleaveDepuncture23(Span<const uint8_t> data, const uint32_t K, const uint32_t a, Span<uint8_t> res)
+{
+    deinterleaveDepuncture23Block<uint8_t>(data, K, a, 2, res);
+}
+
+/**
+ * @brief Viterbi decoding of RCPC code 16-state mother code of rate 1/4 - 8.2.3.1.1
+ *
+ * res must hold data size / 4 bits.
+ *
+ */
+
+void Mac::viterbiDecode1614(Span<const uint8_t> data, Span<uint8_t> res)
+{
+    viterbiCodec1614()->decode(data.data(), data.size(), res.data());           // erased bits (2) from depuncturing are handled by the decoder
 }
 
 /**
- * @brief Depuncture with 2/3 rate - 8.2.3.1.3
+ * @brief Viterbi decoding of count blocks of len bits at once, one block per SIMD lane
+ *
+ * Same results as viterbiDecode1614() on each block, count is at most ControlBlockBatch::LANES.
  *
  */
 
-std::vector<uint8_t> Mac::depuncture23(std::vector<uint8_t> data, const uint32_t len)
+void Mac::viterbiDecode1614Batch(const uint8_t * const * data, const std::size_t count, const std::size_t len, uint8_t * const * res)
 {
-    const uint8_t P[] = {0, 1, 2, 5};                                           // 8.2.3.1.3 - P[1..t]
-    std::vector<uint8_t> res(4 * len * 2 / 3, 2);                               // 8.2.3.1.2 with flag 2 for erase bit in Viterbi routine
+    viterbiCodec1614()->decodeBatch(data, count, len, res);
+}
 
-    uint8_t t = 3;                                                              // 8.2.3.1.3
-    uint8_t period = 8;                                                         // 8.2.3.1.2
+/**
+ * @brief Parity checks of the shortened (30,14) Reed-Muller code used by majority logic decoding - 8.2.3.3
+ *
+ * Each information bit is voted by itself and by 4 independent parity checks.
+ * Bit pos of a mask is the codeword bit pos.
+ *
+ */
 
-    for (uint32_t j = 1; j <= len; j++)
+static const uint32_t gReedMuller3014Checks[14][4] = {
+    {0x011d0000, 0x006cc000, 0x00c78000, 0x01b64000},
+    {0x01464000, 0x009cc000, 0x00378000, 0x01ed0000},
+    {0x01a48000, 0x00d54000, 0x007e0000, 0x010fc000},
+    {0x0e700000, 0x0f01c000, 0x0faa8000, 0x0edb4000},
+    {0x17064000, 0x17ad0000, 0x16dcc000, 0x16778000},
+    {0x1ad00000, 0x1b0a8000, 0x1ba1c000, 0x1a7b4000},
+    {0x1d0d0000, 0x1da64000, 0x1c7cc000, 0x1cd78000},
+    {0x3e548000, 0x3f254000, 0x3f8e0000, 0x3effc000},
+    {0x26418000, 0x27304000, 0x279b0000, 0x26eac000},
+    {0x2a214000, 0x2a8a0000, 0x2b508000, 0x2bfbc000},
+    {0x2c10c000, 0x2d610000, 0x2dca4000, 0x2cbb8000},
+    {0x32488000, 0x33920000, 0x33394000, 0x32e3c000},
+    {0x35a40000, 0x350f4000, 0x34d5c000, 0x347e8000},
+    {0x38128000, 0x39c80000, 0x39634000, 0x38b9c000}
+};
+
+/**
+ * @brief Syndrome decoding tables of the shortened (30,14) Reed-Muller code - 8.2.3.3
+ *
+ * Codewords are packed with bit i = codeword bit i: 14 information bits then
+ * 16 parity bits. The syndrome is the 16 received parity bits XOR the parity
+ * recomputed from the received information bits (two 7 bits lookups).
+ * Minimum distance is 8, so every error pattern of up to 2 bits has its own
+ * syndrome, the correction table gives the information bits to flip for it.
+ * Built once at program start and shared by all decoders.
+ *
+ */
+
+struct ReedMuller3014Tables {
+    static const uint16_t UNKNOWN = 0xFFFF;                                     // syndrome of more than 2 errors
+
+    uint16_t parity[2][128];                                                    // parity bits of information bits 0-6 and 7-13
+    uint16_t correction[65536];                                                 // syndrome -> information bits error pattern
+
+    ReedMuller3014Tables()
     {
-        uint32_t i = j;                                                         // punct->i_func(j);
-        uint32_t k = period * ((i - 1) / t) + P[i - t * ((i - 1) / t)];         // punct->period * ((i-1)/t) + P[i - t*((i-1)/t)];
-        res[k - 1] = data[j - 1];
+        static const uint16_t PARITY[14] = {                                    // parity part of the generator matrix (8.46), first parity bit is MSB
+            0b1001101101100000,
+            0b0010110111100000,
+            0b1111110000100000,
+            0b1110000000111100,
+            0b1001100000111010,
+            0b0101010000110110,
+            0b0010110000101110,
+            0b1111111111011111,
+            0b1000001100111001,
+            0b0100001010110101,
+            0b0010000110101101,
+            0b0001001001110011,
+            0b0000100101101011,
+            0b0000010011100111
+        };
+
+        uint16_t rows[14];
+        for (int idx = 0; idx < 14; idx++)
+        {
+            rows[idx] = 0;
+            for (int bit = 0; bit < 16; bit++)
+            {
+                rows[idx] |= (uint16_t)(((PARITY[idx] >> (15 - bit)) & 1) << bit); // parity bit j at position j
+            }
+        }
+
+        for (uint32_t val = 0; val < 128; val++)
+        {
+            parity[0][val] = 0;
+            parity[1][val] = 0;
+            for (int bit = 0; bit < 7; bit++)
+            {
+                if ((val >> bit) & 1)
+                {
+                    parity[0][val] ^= rows[bit];
+                    parity[1][val] ^= rows[bit + 7];
+                }
+            }
+        }
+
+        for (uint32_t val = 0; val < 65536; val++)
+        {
+            correction[val] = UNKNOWN;
+        }
+
+        correction[0] = 0;                                                      // no error
+        for (int first = 0; first < 30; first++)
+        {
+            uint32_t error = 1u << first;                                       // 1 error
+            correction[syndrome(error)] = (uint16_t)(error & 0x3fff);
+
+            for (int second = first + 1; second < 30; second++)
+            {
+                error = (1u << first) | (1u << second);                         // 2 errors
+                correction[syndrome(error)] = (uint16_t)(error & 0x3fff);
+            }
+        }
     }
 
-    return res;
+    uint16_t syndrome(const uint32_t word) const
+    {
+        return (uint16_t)(parity[0][word & 0x7f] ^ parity[1][(word >> 7) & 0x7f] ^ (word >> 14));
+    }
+};
+
+static const ReedMuller3014Tables gReedMuller3014Tables;
+
+/**
+ * @brief Reed-Muller decoder and FEC correction 30 bits in, 14 bits out
+ *
+ * Up to 2 bit errors are always corrected by syndrome table lookup (minimum
+ * distance 8). Words with more errors have other syndromes and fall back to the
+ * majority logic decoding (FEC thanks to Lollo Gollo @logollo see "issue #21").
+ *
+ */
+
+void Mac::reedMuller3014Decode(Span<const uint8_t> data, Span<uint8_t> res)
+{
+    uint32_t word = 0;
+    for (int idx = 0; idx < 30; idx++)
+    {
+        word |= (uint32_t)(data[idx] & 1) << idx;
+    }
+
+    uint32_t info;
+    const uint16_t error = gReedMuller3014Tables.correction[gReedMuller3014Tables.syndrome(word)];
+
+    if (error != ReedMuller3014Tables::UNKNOWN)
+    {
+        info = (word ^ error) & 0x3fff;
+    }
+    else                                                                        // more than 2 errors, majority logic
+    {
+        info = 0;
+        for (int idx = 0; idx < 14; idx++)
+        {
+            uint32_t votes = (word >> idx) & 1;
+            for (int chk = 0; chk < 4; chk++)
+            {
+                uint32_t val = word & gReedMuller3014Checks[idx][chk];          // parity of the check bits
+                val ^= val >> 16;
+                val ^= val >> 8;
+                val ^= val >> 4;
+                votes += (0x6996 >> (val & 0x0f)) & 1;
+            }
+            info |= (votes >= 3 ? 1u : 0u) << idx;
+        }
+    }
+
+    for (int idx = 0; idx < 14; idx++)
+    {
+        res[idx] = (info >> idx) & 1;
+    }
 }
 
 /**
- * @brief Viterbi decoding of RCPC code 16-state mother code of rate 1/4 - 8.2.3.1.1
+ * @brief Calculated CRC16 ITU-T X.25 - CCITT
  *
  */
 
-std::vector<uint8_t> Mac::viterbiDecode1614(std::vector<uint8_t> data)
+bool Mac::checkCrc16Ccitt(Span<const uint8_t> data, const int len)
 {
-    std::string sIn = "";
-    for (std::size_t idx = 0; idx < data.size(); idx++)
+    return Crc::checkCrc16Ccitt(data.data(), len);                              // table-driven, 8 bits per step
+}
+
+/**
+ * @brief Soft-decision Fibonacci LFSR descrambling - 8.2.5
+ *
+ * Scrambling bit 1 inverts the soft bit sign
+ *
+ */
+
+void Mac::descramble(Span<const int8_t> data, Span<int8_t> res, const uint32_t scramblingCode)
+{
+    const ScramblingCache::Keystream * keystream = ScramblingCache::get(scramblingCode); // blocks are at most MAX_LEN bits
+    const uint8_t * bits = keystream->bits;
+
+    for (std::size_t i = 0; i < res.size(); i++)
     {
-        sIn += (char)(data[idx] + '0');
+        int8_t val = data[i];
+        if (bits[i])
+        {
+            val = (val == -128) ? 127 : (int8_t)(-val);                         // saturated negation
+        }
+        res[i] = val;
     }
+}
 
-    std::string sOut = m_viterbiCodec1614->Decode(sIn);
+/**
+ * @brief Soft-decision deinterleave (K,a) and depuncture with 2/3 rate - 8.2.4 and 8.2.3.1.3
+ *
+ * Punctured bits are erasures (soft value 0)
+ *
+ */
 
-    std::vector<uint8_t> res;
+void Mac::deinterleaveDepuncture23(Span<const int8_t> data, const uint32_t K, const uint32_t a, Span<int8_t> res)
+{
+    deinterleaveDepuncture23Block<int8_t>(data, K, a, 0, res);
+}
 
-    for (size_t idx = 0; idx < sOut.size(); idx++)
+/**
+ * @brief Soft-decision Viterbi decoding of RCPC code 16-state mother code of rate 1/4 - 8.2.3.1.1
+ *
+ * Path metric is the correlation between soft bits and branch outputs (to be maximised),
+ * so erasures do not weight on the decision. The 4 tail bits terminate the trellis in
+ * state 0 which is used to start the traceback.
+ *
+ * Output has the same length as viterbiDecode1614() (len / 4 bits, tail bits included)
+ *
+ */
+
+void Mac::viterbiDecode1614(Span<const int8_t> data, Span<uint8_t> res)
+{
+    const int32_t METRIC_MIN = -(1 << 28);
+
+    const uint8_t * outputs = gViterbiOutputs1614.val;
+
+    const std::size_t steps = data.size() / 4 < BurstScratch::MAX_DECODED_LEN ? data.size() / 4 : BurstScratch::MAX_DECODED_LEN;
+    uint16_t decisions[BurstScratch::MAX_DECODED_LEN];                          // bit s set when predecessor of state s has LSB 1
+
+    int32_t metrics[16];
+    int32_t newMetrics[16];
+    for (uint8_t s = 0; s < 16; s++)
     {
-        res.push_back((uint8_t)(sOut[idx] - '0'));
+        metrics[s] = METRIC_MIN;
     }
+    metrics[0] = 0;
 
-    return res;
+    for (std::size_t t = 0; t < steps; t++)
+    {
+        int32_t bm[16];                                                         // branch metric for each output pattern
+        for (uint8_t pattern = 0; pattern < 16; pattern++)
+        {
+            bm[pattern] = 0;
+            for (uint8_t j = 0; j < 4; j++)
+            {
+                int32_t val = data[4 * t + j];
+                bm[pattern] += ((pattern >> (3 - j)) & 1) ? val : -val;
+            }
+        }
+
+        uint16_t decision = 0;
+        for (uint8_t s = 0; s < 16; s++)
+        {
+            uint8_t u     = s >> 3;
+            uint8_t prev0 = (uint8_t)((s & 0x07) << 1);
+            uint8_t prev1 = (uint8_t)(prev0 | 1);
+
+            int32_t m0 = metrics[prev0] + bm[outputs[(u << 4) | prev0]];
+            int32_t m1 = metrics[prev1] + bm[outputs[(u << 4) | prev1]];
+
+            if (m1 > m0)
+            {
+                newMetrics[s] = m1;
+                decision |= (uint16_t)(1 << s);
+            }
+            else
+            {
+                newMetrics[s] = m0;
+            }
+        }
+
+        decisions[t] = decision;
+        for (uint8_t s = 0; s < 16; s++)
+        {
+            metrics[s] = newMetrics[s];
+        }
+    }
+
+    uint8_t state = 0;                                                          // terminated by tail bits
+
+    for (std::size_t t = steps; t > 0; t--)
+    {
+        res[t - 1] = state >> 3;
+        state = (uint8_t)(((state & 0x07) << 1) | ((decisions[t - 1] >> state) & 1));
+    }
 }
 
 /**
- * @brief Reed-Muller decoder and FEC correction 30 bits in, 14 bits out
+ * @brief Soft-decision Viterbi decoding of count blocks of len soft bits at once, one block per SIMD lane
+ *
+ * Same results as viterbiDecode1614() on each block, count is at most ControlBlockBatch::LANES.
+ *
+ */
+
+void Mac::viterbiDecode1614Batch(const int8_t * const * data, const std::size_t count, const std::size_t len, uint8_t * const * res)
+{
+#if defined(__SSE2__)
+    viterbiCodec1614()->decodeSoftBatch(data, count, len, res);                 // 16-bits metrics, 16 blocks in 2 registers per state
+#else
+    for (std::size_t idx = 0; idx < count; idx++)
+    {
+        viterbiDecode1614(Span<const int8_t>(data[idx], len), Span<uint8_t>(res[idx], len / 4));
+    }
+#endif
+}
+
+/**
+ * @brief Soft-decision Reed-Muller decoder 30 bits in, 14 bits out
+ *
+ * Same majority logic as hard decoder, each of the 5 votes being weighted by
+ * its reliability: soft value for the systematic bit, smallest magnitude of the
+ * bits involved for the parity checks. Hard majority is used when the weighted
+ * sum is null.
+ *
+ */
+
+void Mac::reedMuller3014Decode(Span<const int8_t> data, Span<uint8_t> res)
+{
+    for (std::size_t idx = 0; idx < 14; idx++)
+    {
+        int32_t weighted = data[idx];
+        uint8_t votes    = data[idx] > 0 ? 1 : 0;
+
+        for (std::size_t chk = 0; chk < 4; chk++)
+        {
+            uint8_t parity  = 0;
+            int32_t minimum = 128;
+
+            for (std::size_t pos = 0; pos < 30; pos++)
+            {
+                if ((gReedMuller3014Checks[idx][chk] >> pos) & 1)
+                {
+                    int32_t val = data[pos];
+                    parity ^= val > 0 ? 1 : 0;
+                    minimum = std::min(minimum, val < 0 ? -val : val);
+                }
+            }
+
+            weighted += parity ? minimum : -minimum;
+            votes    += parity;
+        }
+
+        if (weighted != 0)
+        {
+            res[idx] = weighted > 0 ? 1 : 0;
+        }
+        else
+        {
+            res[idx] = votes >= 3 ? 1 : 0;
+        }
+    }
+}
+
+/**
+ * @brief Gather type-5 bits of a block (in one or two parts) from burst and descramble them - 8.2.5
+ *
+ * Result is in scratch block (and softBlock when soft bits are available).
+ *
+ */
+
+void Mac::extractBlock(const uint8_t * data, const int8_t * softData, const uint32_t pos1, const uint32_t len1, const uint32_t pos2, const uint32_t len2, const uint32_t scramblingCode, BurstScratch * scratch)
+{
+    const uint32_t len = len1 + len2;
+
+    scratch->bSoft = (softData != NULL);
+
+    if (scratch->bSoft)
+    {
+        std::copy(softData + pos1, softData + pos1 + len1, scratch->softBlock);
+        std::copy(softData + pos2, softData + pos2 + len2, scratch->softBlock + len1);
+
+        Span<int8_t> block(scratch->softBlock, len);
+        descramble(block, block, scramblingCode);
+
+        for (uint32_t idx = 0; idx < len; idx++)
+        {
+            scratch->block[idx] = scratch->softBlock[idx] > 0 ? 1 : 0;          // hard decision
+        }
+    }
+    else
+    {
+        std::copy(data + pos1, data + pos1 + len1, scratch->block);
+        std::copy(data + pos2, data + pos2 + len2, scratch->block + len1);
+
+        Span<uint8_t> block(scratch->block, len);
+        descramble(block, block, scramblingCode);
+    }
+}
+
+/**
+ * @brief Reed-Muller decoding of the 30 bits AACH block extracted in scratch - 8.2.3.3
+ *
+ */
+
+void Mac::decodeAach(const BurstScratch * scratch, Span<uint8_t> res)
+{
+    if (scratch->bSoft)
+    {
+        reedMuller3014Decode(Span<const int8_t>(scratch->softBlock, 30), res);
+    }
+    else
+    {
+        reedMuller3014Decode(Span<const uint8_t>(scratch->block, 30), res);
+    }
+}
+
+/**
+ * @brief Decoding chain of a control block extracted in scratch: deinterleave, depuncture and Viterbi decode
  *
- * FEC thanks to Lollo Gollo @logollo see "issue #21"
+ * @return Type-2 bits followed by tail bits (K * 2 / 3 bits), valid until next use of scratch
  *
  */
 
-std::vector<uint8_t> Mac::reedMuller3014Decode(std::vector<uint8_t> data)
+Span<const uint8_t> Mac::decodeControlBlock(BurstScratch * scratch, const uint32_t K, const uint32_t a)
 {
-    uint8_t q[5];
-    std::vector<uint8_t> res(14);
-
-    q[0] = data[0];
-    q[1] = (data[13 + 3] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 11]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 2] + data[13 + 5] + data[13 + 6] + data[13 + 8] + data[13 + 9]) % 2;
-    q[3] = (data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 9] + data[13 + 10]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 4] + data[13 + 5] + data[13 + 7] + data[13 + 8] + data[13 + 10] + data[13 + 11]) % 2;
-    res[0] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[1];
-    q[1] = (data[13 + 1] + data[13 + 4] + data[13 + 5] + data[13 + 9] + data[13 + 11]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 2] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 10]) % 2;
-    q[3] = (data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 7] + data[13 + 8]) % 2;
-    q[4] = (data[13 + 3] + data[13 + 5] + data[13 + 6] + data[13 + 8] + data[13 + 9] + data[13 + 10] + data[13 + 11]) % 2;
-    res[1] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[2];
-    q[1] = (data[13 + 2] + data[13 + 5] + data[13 + 8] + data[13 + 10] + data[13 + 11]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 3] + data[13 + 5] + data[13 + 7] + data[13 + 9] + data[13 + 10]) % 2;
-    q[3] = (data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 11]) % 2;
-    res[2] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[3];
-    q[1] = (data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 12] + data[13 + 13] + data[13 + 14]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 14]) % 2;
-    q[3] = (data[13 + 2] + data[13 + 4] + data[13 + 6] + data[13 + 8] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 14]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 3] + data[13 + 4] + data[13 + 6] + data[13 + 7] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 13] + data[13 + 14]) % 2;
-    res[3] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[4];
-    q[1] = (data[13 + 1] + data[13 + 4] + data[13 + 5] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 15]) % 2;
-    q[2] = (data[13 + 3] + data[13 + 5] + data[13 + 6] + data[13 + 8] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 15]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 2] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 13] + data[13 + 15]) % 2;
-    q[4] = (data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 12] + data[13 + 13] + data[13 + 15]) % 2;
-    res[4] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[5];
-    q[1] = (data[13 + 7] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 14] + data[13 + 15]) % 2;
-    q[2] = (data[13 + 2] + data[13 + 4] + data[13 + 6] + data[13 + 11] + data[13 + 12] + data[13 + 14] + data[13 + 15]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 8] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 14] + data[13 + 15]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 3] + data[13 + 4] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 12] + data[13 + 14] + data[13 + 15]) % 2;
-    res[5] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[6];
-    q[1] = (data[13 + 3] + data[13 + 5] + data[13 + 6] + data[13 + 11] + data[13 + 13] + data[13 + 14] + data[13 + 15]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 4] + data[13 + 5] + data[13 + 8] + data[13 + 10] + data[13 + 11] + data[13 + 13] + data[13 + 14] + data[13 + 15]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 2] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 13] + data[13 + 14] + data[13 + 15]) % 2;
-    q[4] = (data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 7] + data[13 + 9] + data[13 + 10] + data[13 + 13] + data[13 + 14] + data[13 + 15]) % 2;
-    res[6] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[7];
-    q[1] = (data[13 + 2] + data[13 + 5] + data[13 + 7] + data[13 + 9] + data[13 + 12] + data[13 + 13] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 3] + data[13 + 5] + data[13 + 8] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 13] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    res[7] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[8];
-    q[1] = (data[13 + 2] + data[13 + 3] + data[13 + 9] + data[13 + 12] + data[13 + 13] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 7] + data[13 + 8] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 3] + data[13 + 4] + data[13 + 6] + data[13 + 7] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 13] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 4] + data[13 + 6] + data[13 + 8] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 13] + data[13 + 16]) % 2;
-    res[8] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[9];
-    q[1] = (data[13 + 1] + data[13 + 3] + data[13 + 8] + data[13 + 12] + data[13 + 14] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 4] + data[13 + 6] + data[13 + 10] + data[13 + 12] + data[13 + 14] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 2] + data[13 + 7] + data[13 + 9] + data[13 + 11] + data[13 + 12] + data[13 + 14] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 14] + data[13 + 16]) % 2;
-    res[9] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[10];
-    q[1] = (data[13 + 1] + data[13 + 2] + data[13 + 7] + data[13 + 13] + data[13 + 14] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 3] + data[13 + 8] + data[13 + 9] + data[13 + 11] + data[13 + 13] + data[13 + 14] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 4] + data[13 + 6] + data[13 + 9] + data[13 + 10] + data[13 + 11] + data[13 + 13] + data[13 + 14] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 10] + data[13 + 13] + data[13 + 14] + data[13 + 16]) % 2;
-    res[10] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[11];
-    q[1] = (data[13 + 2] + data[13 + 6] + data[13 + 9] + data[13 + 12] + data[13 + 15] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 4] + data[13 + 7] + data[13 + 10] + data[13 + 11] + data[13 + 12] + data[13 + 15] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 3] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 11] + data[13 + 12] + data[13 + 15] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 4] + data[13 + 8] + data[13 + 9] + data[13 + 10] + data[13 + 12] + data[13 + 15] + data[13 + 16]) % 2;
-    res[11] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[12];
-    q[1] = (data[13 + 5] + data[13 + 8] + data[13 + 10] + data[13 + 11] + data[13 + 13] + data[13 + 15] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 1] + data[13 + 3] + data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 11] + data[13 + 13] + data[13 + 15] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 5] + data[13 + 7] + data[13 + 9] + data[13 + 10] + data[13 + 13] + data[13 + 15] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 2] + data[13 + 4] + data[13 + 5] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 9] + data[13 + 13] + data[13 + 15] + data[13 + 16]) % 2;
-    res[12] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    q[0] = data[13];
-    q[1] = (data[13 + 2] + data[13 + 4] + data[13 + 7] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[2] = (data[13 + 6] + data[13 + 9] + data[13 + 10] + data[13 + 11] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[3] = (data[13 + 1] + data[13 + 3] + data[13 + 4] + data[13 + 8] + data[13 + 9] + data[13 + 11] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    q[4] = (data[13 + 1] + data[13 + 2] + data[13 + 3] + data[13 + 6] + data[13 + 7] + data[13 + 8] + data[13 + 10] + data[13 + 14] + data[13 + 15] + data[13 + 16]) % 2;
-    res[13] = (q[0] + q[1] + q[2] + q[3] + q[4]) >= 3 ? 1 : 0;
-
-    // check deviation from input
-    // int deviation = 0;
-    // for (int cnt = 0; cnt < 14; cnt++)
-    // {
-    //     deviation += (data[cnt] != res[cnt]) ? 1 : 0;
-    // }
-    // printf("FEC correction %.2f\n", deviation / 14.);
-    // print_vector(data, 14);
-    // print_vector(res, 14);
-
-    //return vector_extract(data, 0, 14);
+    const std::size_t motherLen = 4 * K * 2 / 3;
+    Span<uint8_t> res(scratch->decoded, motherLen / 4);
+
+    if (scratch->bSoft)
+    {
+        Span<int8_t> mother(scratch->softMother, motherLen);
+        deinterleaveDepuncture23(Span<const int8_t>(scratch->softBlock, K), K, a, mother);
+        viterbiDecode1614(mother, res);
+    }
+    else
+    {
+        Span<uint8_t> mother(scratch->mother, motherLen);
+        deinterleaveDepuncture23(Span<const uint8_t>(scratch->block, K), K, a, mother);
+        viterbiDecode1614(mother, res);
+    }
 
     return res;
 }
 
 /**
- * @brief Calculated CRC16 ITU-T X.25 - CCITT
+ * @brief Decoding chain of a broadcast block extracted in scratch, through the broadcast blocks cache
+ *
+ * Same result as decodeControlBlock() followed by the CRC check (crcValid), but a block
+ * received exactly as a recent one with a valid CRC is not decoded again.
+ *
+ * @return Type-2 bits followed by tail bits (K * 2 / 3 bits), valid until next use of scratch
  *
  */
 
-int Mac::checkCrc16Ccitt(std::vector<uint8_t> data, const int len)
+Span<const uint8_t> Mac::decodeBroadcastBlock(BurstScratch * scratch, const uint32_t K, const uint32_t a, bool * crcValid)
 {
-    uint16_t crc = 0xFFFF;                                                      // CRC16-CCITT initial value
+    const uint8_t * block = scratch->bSoft ? (const uint8_t *)scratch->softBlock : scratch->block;
+
+    if (BroadcastCache::find(block, K, scratch->bSoft, scratch->decoded))
+    {
+        *crcValid = true;
+        return Span<const uint8_t>(scratch->decoded, K * 2 / 3);
+    }
 
-    for (int i = 0; i < len; i++)
+    Span<const uint8_t> decoded = decodeControlBlock(scratch, K, a);
+    *crcValid = checkCrc16Ccitt(decoded, (int)(K * 2 / 3) - 4);                 // CRC is followed by 4 tail bits
+    if (*crcValid)
     {
-        uint16_t bit = (uint16_t)data[i];
+        BroadcastCache::store(block, K, scratch->bSoft, decoded.data());
+    }
 
-        crc ^= bit << 15;
-        if(crc & 0x8000)
+    return decoded;
+}
+
+/**
+ * @brief Deinterleave and depuncture the control block extracted in scratch into the next lane of batch
+ *
+ * Batch must have room left and the same bits type (hard or soft) as scratch.
+ *
+ */
+
+void Mac::queueControlBlock(const BurstScratch * scratch, DecodedBurst * burst, const bool bBkn2, ControlBlockBatch * batch)
+{
+    const std::size_t lane = batch->count;
+    const std::size_t motherLen = 4 * batch->K * 2 / 3;
+
+    if (scratch->bSoft)
+    {
+        deinterleaveDepuncture23(Span<const int8_t>(scratch->softBlock, batch->K), batch->K, batch->a, Span<int8_t>(batch->softMother[lane], motherLen));
+    }
+    else
+    {
+        deinterleaveDepuncture23(Span<const uint8_t>(scratch->block, batch->K), batch->K, batch->a, Span<uint8_t>(batch->mother[lane], motherLen));
+    }
+
+    batch->bSoft        = scratch->bSoft;
+    batch->bursts[lane] = burst;
+    batch->bBkn2[lane]  = bBkn2;
+    batch->count++;
+}
+
+/**
+ * @brief Viterbi decode all blocks of batch at once and check their CRC
+ *
+ * Decoded blocks are type-2 bits followed by tail bits (K * 2 / 3 bits), CRC result
+ * of each block is in crcValid.
+ *
+ */
+
+void Mac::decodeControlBlocks(ControlBlockBatch * batch)
+{
+    const std::size_t motherLen = 4 * batch->K * 2 / 3;
+    const int crcLen = (int)(batch->K * 2 / 3) - 4;                             // type-2 bits without tail bits
+
+    uint8_t * res[ControlBlockBatch::LANES];
+    for (std::size_t lane = 0; lane < batch->count; lane++)
+    {
+        res[lane] = batch->decoded[lane];
+    }
+
+    if (batch->bSoft)
+    {
+        const int8_t * mother[ControlBlockBatch::LANES];
+        for (std::size_t lane = 0; lane < batch->count; lane++)
         {
-            crc <<= 1;
-            crc ^= 0x1021;                                                      // CRC16-CCITT polynomial
+            mother[lane] = batch->softMother[lane];
         }
-        else
+        viterbiDecode1614Batch(mother, batch->count, motherLen, res);
+    }
+    else
+    {
+        const uint8_t * mother[ControlBlockBatch::LANES];
+        for (std::size_t lane = 0; lane < batch->count; lane++)
         {
-            crc <<= 1;
+            mother[lane] = batch->mother[lane];
         }
+        viterbiDecode1614Batch(mother, batch->count, motherLen, res);
     }
 
-    return crc == 0x1D0F;                                                       // CRC16-CCITT reminder value
+    for (std::size_t lane = 0; lane < batch->count; lane++)
+    {
+        batch->crcValid[lane] = checkCrc16Ccitt(Span<const uint8_t>(batch->decoded[lane], motherLen / 4), crcLen);
+    }
 }
@@ -20,7 +20,19 @@
 
 using namespace Tetra;
 
-static int curBurstType;
+/**
+ * @brief Viterbi codec shared by all MAC instances, read-only once built
+ *
+ * 8.2.3.1.1 RCPC 16-state mother code of rate 1/4, see ViterbiCodec1614
+ *
+ */
+
+const ViterbiCodec1614 * Mac::viterbiCodec1614()
+{
+    static const ViterbiCodec1614 codec;                                        // thread-safe initialization
+
+    return &codec;
+}
 
 /**
  * @brief Constructor
@@ -51,28 +63,17 @@ Mac::Mac(Log * log, Report * report, TetraCell * tetraCell, UPlane * uPlane, Llc
         m_usageMarkerEncryptionMode[idx] = 0;
     }
 
-    /*
-     * Initialize Viterbi coder/decoder for MAC
-     *
-     * 8.2.3.1.1 Generator polynomials for the RCPC 16-state mother code of rate 1/4
-     *
-     * G1 = 1 + D +             D^4 (8.3)
-     * G2 = 1 +     D^2 + D^3 + D^4 (8.4)
-     * G3 = 1 + D + D^2 +       D^4 (8.5)
-     * G4 = 1 + D +       D^3 + D^4 (8.6)
-     *
-     * NOTE: representing bit order must be reversed for the codec, eg. 1 + D + 0 + 0 + D^4 -> 10011
-     *
-     */
-
-    std::vector<int> polynomials;
-    int constraint = 6;
-
-    polynomials.push_back(0b10011);
-    polynomials.push_back(0b11101);
-    polynomials.push_back(0b10111);
-    polynomials.push_back(0b11011);
-    m_viterbiCodec1614 = new ViterbiCodec(constraint, polynomials);
+    m_curBurstType = 0;
+
+    // decode everything but idle slots by default
+    m_decodePolicy.timeslots = 0x0F;
+    m_decodePolicy.bTraffic  = true;
+    m_decodePolicy.bSkipIdle = true;
+
+    m_decodeSkipCounters.unallocated = 0;
+    m_decodeSkipCounters.reserved    = 0;
+    m_decodeSkipCounters.timeslot    = 0;
+    m_decodeSkipCounters.traffic     = 0;
 }
 
 /**
@@ -82,7 +83,7 @@ Mac::Mac(Log * log, Report * report, TetraCell * tetraCell, UPlane * uPlane, Llc
 
 Mac::~Mac()
 {
-    delete m_viterbiCodec1614;
+
 }
 
 /**
@@ -125,6 +126,26 @@ void Mac::incrementTn()
     }
 }
 
+/**
+ * @brief Set channel decoding policy
+ *
+ */
+
+void Mac::setDecodePolicy(const DecodePolicy & policy)
+{
+    m_decodePolicy = policy;
+}
+
+/**
+ * @brief Return bursts count with skipped channel decoding
+ *
+ */
+
+DecodeSkipCounters Mac::getDecodeSkipCounters()
+{
+    return m_decodeSkipCounters;
+}
+
 /**
  * @brief Returns PHY burst name
  *
@@ -173,17 +194,419 @@ std::string Mac::burstName(int val)
  * Notes:
  *   - AACH must be processed first to get traffic or signalling mode
  *   - Fill bit deletion to be tested (see 23.4.3.2)
+ *   - when soft bits are available (softData not NULL) they are used for decoding instead of hard bits
+ *   - synchronous path: only AACH and BSCH are decoded upfront, BKN blocks are decoded
+ *     when needed according to AACH and decoding policy
+ *
+ */
+
+void Mac::serviceLowerMac(const uint8_t * data, int burstType, const int8_t * softData)
+{
+    DecodedBurst burst;
+
+    decodeBurst(data, softData, burstType, m_tetraCell->getScramblingCode(), DECODE_AACH | DECODE_BSCH, &burst);
+    serviceDecodedBurst(burst, data, softData);
+}
+
+/**
+ * @brief Channel decoding of burst blocks (8.3), doesn't depend on MAC state
+ *
+ * @param data            Burst hard bits (510 bits)
+ * @param softData        Burst soft bits (510 bits) or NULL
+ * @param burstType       Burst type
+ * @param scramblingCode  Scrambling code to use (except for BSCH which always uses 0x0003)
+ * @param blocks          Blocks to decode (DecodeBlocks), other blocks are left empty
+ * @param res             Decoded blocks
+ *
+ */
+
+void Mac::decodeBurst(const uint8_t * data, const int8_t * softData, const int burstType, const uint32_t scramblingCode, const int blocks, DecodedBurst * res)
+{
+    res->burstType      = burstType;
+    res->scramblingCode = scramblingCode;
+    res->decodedBlocks  = 0;
+    res->bbk.len  = 0;
+    res->bkn1.len = 0;
+    res->bkn2.len = 0;
+    res->tch.len  = 0;
+    res->bkn1CrcValid = false;
+    res->bkn2CrcValid = false;
+
+    decodeBurstBlocks(data, softData, blocks, res);
+}
+
+/**
+ * @brief Channel decoding of burst blocks not decoded yet, with the burst scrambling code
+ *
+ * @param data      Burst hard bits (510 bits)
+ * @param softData  Burst soft bits (510 bits) or NULL
+ * @param blocks    Blocks to decode (DecodeBlocks), blocks already decoded are kept
+ * @param res       Decoded blocks
+ *
+ */
+
+void Mac::decodeBurstBlocks(const uint8_t * data, const int8_t * softData, const int blocks, DecodedBurst * res)
+{
+    static thread_local BurstScratch scratch;                                   // reused across bursts, no heap allocation
+
+    const int burstType = res->burstType;
+    const uint32_t scramblingCode = res->scramblingCode;
+    const int todo = blocks & ~res->decodedBlocks;
+
+    if (todo == 0)
+    {
+        return;
+    }
+
+#ifdef DEBUG_ALLOC_COUNT
+    const uint64_t allocationsBefore = AllocCount::thread();
+#endif
+
+    Span<const uint8_t> decoded;
+
+    if (burstType == SB)                                                        // synchronisation burst
+    {
+        // BKN1 block - BSCH - SB seems to be sent only on FN=18 thus BKN1 contains only BSCH
+        if (todo & DECODE_BSCH)
+        {
+            extractBlock(data, softData, 94, 120, 0, 0, 0x0003, &scratch);      // descramble with predefined code 0x0003
+            decoded = decodeBroadcastBlock(&scratch, 120, 11, &res->bkn1CrcValid); // 120 bits -> 4 * 80 bits before Viterbi decoding - see 8.3.1.2 (K1 + 16, K1) block code with K1 = 60
+            res->bkn1.assign(decoded);                                          // only 60 bits are meaningful
+        }
+
+        // BBK block - AACH
+        if (todo & DECODE_AACH)
+        {
+            extractBlock(data, softData, 252, 30, 0, 0, scramblingCode, &scratch);
+            decodeAach(&scratch, Span<uint8_t>(res->bbk.bits, 14));             // Reed-Muller correction
+            res->bbk.len = 14;
+        }
+
+        // BKN2 block - BNCH
+        if (todo & DECODE_BKN)
+        {
+            extractBlock(data, softData, 282, 216, 0, 0, scramblingCode, &scratch);
+            decoded = decodeBroadcastBlock(&scratch, 216, 101, &res->bkn2CrcValid); // 216 bits -> 4 * 144 bits before Viterbi decoding
+            if (res->bkn2CrcValid)
+            {
+                res->bkn2.assign(decoded.subspan(0, 124));
+            }
+        }
+    }
+    else if (burstType == NDB)                                                  // 1 logical channel in time slot
+    {
+        // BBK block - in two parts
+        if (todo & DECODE_AACH)
+        {
+            extractBlock(data, softData, 230, 14, 266, 16, scramblingCode, &scratch);
+            decodeAach(&scratch, Span<uint8_t>(res->bbk.bits, 14));             // Reed-Muller correction
+            res->bbk.len = 14;
+        }
+
+        // BKN1 + BKN2
+        if (todo & (DECODE_BKN | DECODE_SCH_F))
+        {
+            extractBlock(data, softData, 14, 216, 282, 216, scramblingCode, &scratch); // reconstruct block to BKN1
+        }
+
+        if (todo & DECODE_BKN)
+        {
+            res->tch.assign(Span<const uint8_t>(scratch.block, 432));           // traffic mode: frame is sent directly to User plane
+        }
+
+        if (todo & DECODE_SCH_F)                                                // signalling mode decoding
+        {
+            decoded = decodeControlBlock(&scratch, 432, 103);                   // 432 bits -> 4 * 288 bits before Viterbi decoding
+            if (checkCrc16Ccitt(decoded, 284))                                  // check CRC
+            {
+                res->bkn1.assign(decoded.subspan(0, 268));
+                res->bkn1CrcValid = true;
+            }
+        }
+    }
+    else if (burstType == NDB_SF)                                               // NDB with stolen flag
+    {
+        // BBK block - AACH in two parts
+        if (todo & DECODE_AACH)
+        {
+            extractBlock(data, softData, 230, 14, 266, 16, scramblingCode, &scratch);
+            decodeAach(&scratch, Span<uint8_t>(res->bbk.bits, 14));             // Reed-Muller correction
+            res->bbk.len = 14;
+        }
+
+        if (todo & DECODE_BKN)
+        {
+            // BKN1 block - always SCH/HD (CP channel)
+            extractBlock(data, softData, 14, 216, 0, 0, scramblingCode, &scratch);
+            decoded = decodeControlBlock(&scratch, 216, 101);                   // 216 bits -> 4 * 144 bits before Viterbi decoding
+            if (checkCrc16Ccitt(decoded, 140))                                  // check CRC
+            {
+                res->bkn1.assign(decoded.subspan(0, 124));
+                res->bkn1CrcValid = true;
+            }
+
+            // BKN2 block - SCH/HD or BNCH
+            extractBlock(data, softData, 282, 216, 0, 0, scramblingCode, &scratch);
+            decoded = decodeControlBlock(&scratch, 216, 101);
+            if (checkCrc16Ccitt(decoded, 140))                                  // check CRC
+            {
+                res->bkn2.assign(decoded.subspan(0, 124));
+                res->bkn2CrcValid = true;
+            }
+        }
+    }
+
+    res->decodedBlocks |= todo;
+
+#ifdef DEBUG_ALLOC_COUNT
+    AllocCount::addDecodingPass(AllocCount::thread() - allocationsBefore);
+#endif
+}
+
+/**
+ * @brief Channel decoding of burst blocks not decoded yet for count bursts at once
+ *
+ * Same results as decodeBurstBlocks() called on each burst, but SCH/HD and SCH/F blocks
+ * of all bursts are Viterbi decoded together, ControlBlockBatch::LANES blocks of the
+ * same length at once. Other blocks are decoded burst by burst.
+ *
+ * @param data      Hard bits of each burst (510 bits)
+ * @param softData  Soft bits of each burst (510 bits) or NULL
+ * @param blocks    Blocks to decode (DecodeBlocks), blocks already decoded are kept
+ * @param res       Decoded blocks of each burst
+ * @param count     Bursts count
+ *
+ */
+
+void Mac::decodeBurstsBlocks(const uint8_t * const * data, const int8_t * const * softData, const int blocks, DecodedBurst * const * res, const std::size_t count)
+{
+    static thread_local BurstScratch scratch;                                   // reused across calls, no heap allocation
+    static thread_local ControlBlockBatch batchHd;                              // SCH/HD and BNCH blocks
+    static thread_local ControlBlockBatch batchF;                               // SCH/F blocks
+
+    batchHd.K = 216;
+    batchHd.a = 101;
+    batchHd.count = 0;
+    batchF.K = 432;
+    batchF.a = 103;
+    batchF.count = 0;
+
+    for (std::size_t idx = 0; idx < count; idx++)
+    {
+        DecodedBurst * burst = res[idx];
+        const int burstType  = burst->burstType;
+
+        int batched = 0;                                                        // blocks with Viterbi decoding, except broadcast ones (SB) which go through the cache
+        if (burstType == NDB_SF)
+        {
+            batched = DECODE_BKN;
+        }
+        else if (burstType == NDB)
+        {
+            batched = DECODE_SCH_F;
+        }
+
+        decodeBurstBlocks(data[idx], softData[idx], blocks & ~batched, burst);
+
+        const int todo = blocks & batched & ~burst->decodedBlocks;
+        if (todo == 0)
+        {
+            continue;
+        }
+
+        const bool bSoft = (softData[idx] != NULL);
+        if ((batchHd.count > 0) && (batchHd.bSoft != bSoft))                    // a batch holds either hard or soft blocks
+        {
+            flushControlBlocks(&batchHd);
+        }
+        if ((batchF.count > 0) && (batchF.bSoft != bSoft))
+        {
+            flushControlBlocks(&batchF);
+        }
+
+        // same blocks positions as decodeBurstBlocks()
+        if (burstType == NDB)
+        {
+            extractBlock(data[idx], softData[idx], 14, 216, 282, 216, burst->scramblingCode, &scratch);
+            queueControlBlock(&scratch, burst, false, &batchF);                 // BKN1 + BKN2 as SCH/F
+        }
+        else
+        {
+            extractBlock(data[idx], softData[idx], 14, 216, 0, 0, burst->scramblingCode, &scratch);
+            queueControlBlock(&scratch, burst, false, &batchHd);                // BKN1
+            if (batchHd.count == ControlBlockBatch::LANES)
+            {
+                flushControlBlocks(&batchHd);
+            }
+
+            extractBlock(data[idx], softData[idx], 282, 216, 0, 0, burst->scramblingCode, &scratch);
+            queueControlBlock(&scratch, burst, true, &batchHd);                 // BKN2
+        }
+
+        if (batchHd.count == ControlBlockBatch::LANES)
+        {
+            flushControlBlocks(&batchHd);
+        }
+        if (batchF.count == ControlBlockBatch::LANES)
+        {
+            flushControlBlocks(&batchF);
+        }
+
+        burst->decodedBlocks |= todo;                                           // blocks are stored at the latest by the final flush
+    }
+
+    flushControlBlocks(&batchHd);
+    flushControlBlocks(&batchF);
+}
+
+/**
+ * @brief Decode the blocks queued in batch and store those with a valid CRC in their bursts
+ *
+ */
+
+void Mac::flushControlBlocks(ControlBlockBatch * batch)
+{
+    if (batch->count == 0)
+    {
+        return;
+    }
+
+    decodeControlBlocks(batch);
+
+    const std::size_t len = batch->K * 2 / 3 - 4 - 16;                          // type-1 bits: without tail bits and CRC
+
+    for (std::size_t lane = 0; lane < batch->count; lane++)
+    {
+        if (batch->crcValid[lane])
+        {
+            DecodedBurst * burst = batch->bursts[lane];
+            Span<const uint8_t> decoded(batch->decoded[lane], len);
+
+            if (batch->bBkn2[lane])
+            {
+                burst->bkn2.assign(decoded);
+                burst->bkn2CrcValid = true;
+            }
+            else
+            {
+                burst->bkn1.assign(decoded);
+                burst->bkn1CrcValid = true;
+            }
+        }
+    }
+
+    batch->count = 0;
+}
+
+/**
+ * @brief Return true when decoded AACH marks the slot as unallocated or reserved - see 21.4.7
+ *
+ * Doesn't take into account frame 18 which is always reserved for control signalling,
+ * so it's only a hint to skip decoding before TDMA time is known.
+ *
+ */
+
+bool Mac::isIdleAach(const DecodedBurst & burst)
+{
+    if (!(burst.decodedBlocks & DECODE_AACH))
+    {
+        return false;
+    }
+
+    const uint8_t header = (uint8_t)((burst.bbk.bits[0] << 1) | burst.bbk.bits[1]);
+    uint8_t field1 = 0;
+    for (std::size_t idx = 2; idx < 8; idx++)
+    {
+        field1 = (uint8_t)((field1 << 1) | burst.bbk.bits[idx]);
+    }
+
+    return (header != 0b00) && ((field1 == 0b000000) || (field1 == 0b000011)); // unallocated or reserved
+}
+
+/**
+ * @brief Decode burst blocks still needed, with the current scrambling code
+ *
+ * When blocks were decoded with a scrambling code which is not the current one
+ * (eg. speculative decoding before the BSCH of the same burst has been processed),
+ * they are decoded again from the raw data (except BSCH which doesn't depend on it).
+ *
+ */
+
+void Mac::completeBurst(DecodedBurst * burst, const uint8_t * data, const int8_t * softData, const int blocks)
+{
+    const uint32_t scramblingCode = m_tetraCell->getScramblingCode();
+
+    if (burst->scramblingCode != scramblingCode)
+    {
+        burst->scramblingCode = scramblingCode;
+        burst->decodedBlocks &= DECODE_BSCH;                                    // BSCH always uses 0x0003
+        burst->bbk.len  = 0;
+        burst->bkn2.len = 0;
+        burst->tch.len  = 0;
+        burst->bkn2CrcValid = false;
+        if (burst->burstType != SB)
+        {
+            burst->bkn1.len = 0;
+            burst->bkn1CrcValid = false;
+        }
+    }
+
+    decodeBurstBlocks(data, softData, blocks, burst);
+}
+
+/**
+ * @brief Return true when BKN blocks of the current slot must not be decoded
+ *        according to decoding policy, AACH must have been processed
  *
  */
 
-void Mac::serviceLowerMac(std::vector<uint8_t> data, int burstType)
+bool Mac::skipBurstBlocks()
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - burst = %s data = %s\n", "service_lower_mac", burstName(burstType).c_str(), vectorToString(data, data.size()).c_str());
+    if (!(m_decodePolicy.timeslots & (1 << (m_tetraTime.tn - 1))))
+    {
+        m_decodeSkipCounters.timeslot++;
+        return true;
+    }
+
+    if (m_decodePolicy.bSkipIdle)
+    {
+        if (m_macState.downlinkUsage == UNALLOCATED)
+        {
+            m_decodeSkipCounters.unallocated++;
+            return true;
+        }
+        else if (m_macState.downlinkUsage == RESERVED)
+        {
+            m_decodeSkipCounters.reserved++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Service upper MAC with decoded burst blocks, in TDMA order
+ *
+ * Blocks which are needed but not decoded yet are decoded here, blocks
+ * skipped by decoding policy are never decoded.
+ *
+ * @param burst     Decoded burst, completed as needed
+ * @param data      Burst hard bits (510 bits)
+ * @param softData  Burst soft bits (510 bits) or NULL
+ *
+ */
+
+void Mac::serviceDecodedBurst(DecodedBurst & burst, const uint8_t * data, const int8_t * softData)
+{
+    const int burstType = burst.burstType;
+
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - burst = %s data = %s\n", "service_lower_mac", burstName(burstType).c_str(), vectorToString(data, 510).c_str());
 
     bool bnchFlag = false;
     //bool bsch_flag = false;
 
-    curBurstType = burstType;
+    m_curBurstType = burstType;
 
     if (m_tetraTime.fn == 18)
     {
@@ -199,116 +622,83 @@ void Mac::serviceLowerMac(std::vector<uint8_t> data, int burstType)
 
     m_secondSlotStolenFlag = 0;                                                 // stolen flag lifetime is NDB_SF burst life only
 
-    std::vector<uint8_t> bkn1;                                                  // busrt block BKN1
-    std::vector<uint8_t> bkn2;                                                  // burst block BKN2
-    std::vector<uint8_t> bbk;                                                   // burst block BBK
-
     if (burstType == SB)                                                        // synchronisation burst
     {
-        // BKN1 block - BSCH - SB seems to be sent only on FN=18 thus BKN1 contains only BSCH
-        bkn1 = vectorExtract(data, 94,  120);
-        bkn1 = descramble(bkn1, 120, 0x0003);                                   // descramble with predefined code 0x0003
-        bkn1 = deinterleave(bkn1, 120, 11);                                     // deinterleave 120, 11
-        bkn1 = depuncture23(bkn1, 120);                                         // depuncture with 2/3 rate 120 bits -> 4 * 80 bits before Viterbi decoding
-        bkn1 = viterbiDecode1614(bkn1);                                         // Viterbi decode - see 8.3.1.2  (K1 + 16, K1) block code with K1 = 60
-        if (checkCrc16Ccitt(bkn1, 76))                                          // BSCH found process immediately to calculate scrambling code
+        decodeBurstBlocks(data, softData, DECODE_BSCH, &burst);
+
+        if (burst.bkn1CrcValid)                                                 // BSCH found process immediately to calculate scrambling code
         {
-            serviceUpperMac(bkn1, BSCH);                                        // only 60 bits are meaningful
+            serviceUpperMac(burst.bkn1.view(), BSCH);                           // only 60 bits are meaningful
         }
 
-        // BBK block - AACH
-        bbk = vectorExtract(data, 252, 30);                                     // BBK
-        bbk = descramble(bbk,  30, m_tetraCell->getScramblingCode());           // descramble
-        bbk = reedMuller3014Decode(bbk);                                        // Reed-Muller correction
-        serviceUpperMac(bbk, AACH);
-
-        // BKN2 block
-        bkn2 = vectorExtract(data, 282, 216);
-        bkn2 = descramble(bkn2, 216, m_tetraCell->getScramblingCode());         // descramble
-        bkn2 = deinterleave(bkn2, 216, 101);                                    // deinterleave
-        bkn2 = depuncture23(bkn2, 216);                                         // depuncture with 2/3 rate 144 bits -> 4 * 144 bits before Viterbi decoding
-        bkn2 = viterbiDecode1614(bkn2);                                         // Viterbi decode
-        if (checkCrc16Ccitt(bkn2, 140))                                         // check CRC
+        completeBurst(&burst, data, softData, DECODE_AACH);                     // BBK and BKN2 are scrambled with the new code
+        serviceUpperMac(burst.bbk.view(), AACH);
+
+        if (!skipBurstBlocks())
         {
-            bkn2 = vectorExtract(bkn2, 0, 124);
-            serviceUpperMac(bkn2, SCH_HD);
+            completeBurst(&burst, data, softData, DECODE_BKN);
+            if (burst.bkn2CrcValid)
+            {
+                serviceUpperMac(burst.bkn2.view(), SCH_HD);
+            }
         }
     }
     else if (burstType == NDB)                                                  // 1 logical channel in time slot
     {
-        // BBK block
-        bbk = vectorAppend(vectorExtract(data, 230, 14), vectorExtract(data, 266, 16)); // BBK is in two parts
-        bbk = descramble(bbk, 30, m_tetraCell->getScramblingCode());                    // descramble
-        bbk = reedMuller3014Decode(bbk);                                                // Reed-Muller correction
-        serviceUpperMac(bbk, AACH);
+        completeBurst(&burst, data, softData, DECODE_AACH);
+        serviceUpperMac(burst.bbk.view(), AACH);
 
-        // BKN1 + BKN2
-        bkn1 = vectorAppend(vectorExtract(data, 14, 216), vectorExtract(data, 282, 216)); // reconstruct block to BKN1
-        bkn1 = descramble(bkn1, 432, m_tetraCell->getScramblingCode());                   // descramble
+        if (skipBurstBlocks())
+        {
+            return;
+        }
 
         if ((m_macState.downlinkUsage == TRAFFIC) && (m_tetraTime.fn <= 17))    // traffic mode
         {
-            serviceUpperMac(bkn1, TCH_S);                                       // frame is sent directly to User plane
+            if (m_decodePolicy.bTraffic)
+            {
+                completeBurst(&burst, data, softData, DECODE_BKN);
+                serviceUpperMac(burst.tch.view(), TCH_S);                       // frame is sent directly to User plane
+            }
+            else
+            {
+                m_decodeSkipCounters.traffic++;
+            }
         }
         else                                                                    // signalling mode
         {
-            bkn1 = deinterleave(bkn1, 432, 103);                                // deinterleave
-            bkn1 = depuncture23(bkn1, 432);                                     // depuncture with 2/3 rate 288 bits -> 4 * 288 bits before Viterbi decoding
-            bkn1 = viterbiDecode1614(bkn1);                                     // Viterbi decode
-            if (checkCrc16Ccitt(bkn1, 284))                                     // check CRC
+            completeBurst(&burst, data, softData, DECODE_SCH_F);
+
+            if (burst.bkn1CrcValid)
             {
-                bkn1 = vectorExtract(bkn1, 0, 268);
-                serviceUpperMac(bkn1, SCH_F);
+                serviceUpperMac(burst.bkn1.view(), SCH_F);
             }
         }
     }
     else if (burstType == NDB_SF)                                               // NDB with stolen flag
     {
-        bool bkn1ValidFlag = false;
-        bool bkn2ValidFlag = false;
+        completeBurst(&burst, data, softData, DECODE_AACH);
+        serviceUpperMac(Pdu(burst.bbk.view()), AACH);
 
-        // BBK block - AACH
-        bbk = vectorAppend(vectorExtract(data, 230, 14), vectorExtract(data, 266, 16)); // BBK is in two parts
-        bbk = descramble(bbk, 30, m_tetraCell->getScramblingCode());                    // descramble
-        bbk = reedMuller3014Decode(bbk);                                                // Reed-Muller correction
-        serviceUpperMac(Pdu(bbk), AACH);
-
-        // BKN1 block - always SCH/HD (CP channel)
-        bkn1 = vectorExtract  (data, 14, 216);
-        bkn1 = descramble(bkn1, 216, m_tetraCell->getScramblingCode());         // descramble
-        bkn1 = deinterleave(bkn1, 216, 101);                                    // deinterleave
-        bkn1 = depuncture23(bkn1, 216);                                         // depuncture with 2/3 rate 144 bits -> 4 * 144 bits before Viterbi decoding
-        bkn1 = viterbiDecode1614(bkn1);                                         // Viterbi decode
-        if (checkCrc16Ccitt(bkn1, 140))                                         // check CRC
+        if (skipBurstBlocks())
         {
-            bkn1 = vectorExtract(bkn1, 0, 124);
-            bkn1ValidFlag = true;
+            return;
         }
 
-        // BKN2 block - SCH/HD or BNCH
-        bkn2 = vectorExtract(data, 282, 216);
-        bkn2 = descramble(bkn2, 216, m_tetraCell->getScramblingCode());         // descramble
-        bkn2 = deinterleave(bkn2, 216, 101);                                    // deinterleave
-        bkn2 = depuncture23(bkn2, 216);                                         // depuncture with 2/3 rate 144 bits -> 4 * 144 bits before Viterbi decoding
-        bkn2 = viterbiDecode1614(bkn2);                                         // Viterbi decode
-        if (checkCrc16Ccitt(bkn2, 140))                                         // check CRC
-        {
-            bkn2 = vectorExtract(bkn2, 0, 124);
-            bkn2ValidFlag = true;
-        }
+        completeBurst(&burst, data, softData, DECODE_BKN);
 
         if ((m_macState.downlinkUsage == TRAFFIC) && (m_tetraTime.fn <= 17))    // traffic mode
         {
-            if (bkn1ValidFlag)
+            if (burst.bkn1CrcValid)
             {
-                serviceUpperMac(Pdu(bkn1), STCH);                               // first block is stolen for C or U signalling
+                serviceUpperMac(Pdu(burst.bkn1.view()), STCH);                  // first block is stolen for C or U signalling
             }
 
             if (m_secondSlotStolenFlag)                                         // if second slot is also stolen
             {
-                if (bkn2ValidFlag)
+                if (burst.bkn2CrcValid)
                 {
-                    serviceUpperMac(Pdu(bkn2), STCH);                           // second block also stolen, reset flag
+                    serviceUpperMac(Pdu(burst.bkn2.view()), STCH);              // second block also stolen, reset flag
                 }
             }
             else                                                                // second slot not stolen, so it is still traffic mode
@@ -318,20 +708,20 @@ void Mac::serviceLowerMac(std::vector<uint8_t> data, int burstType)
         }
         else                                                                    // otherwise signalling mode (see 19.4.4)
         {
-            if (bkn1ValidFlag)
+            if (burst.bkn1CrcValid)
             {
-                serviceUpperMac(Pdu(bkn1), SCH_HD);
+                serviceUpperMac(Pdu(burst.bkn1.view()), SCH_HD);
             }
 
-            if (bkn2ValidFlag)
+            if (burst.bkn2CrcValid)
             {
                 if (bnchFlag)
                 {
-                    serviceUpperMac(Pdu(bkn2), BNCH);
+                    serviceUpperMac(Pdu(burst.bkn2.view()), BNCH);
                 }
                 else
                 {
-                    serviceUpperMac(Pdu(bkn2), SCH_HD);
+                    serviceUpperMac(Pdu(burst.bkn2.view()), SCH_HD);
                 }
             }
         }
@@ -370,9 +760,9 @@ void Mac::serviceLowerMac(std::vector<uint8_t> data, int burstType)
  *   unknown = 9
  */
 
-void Mac::serviceUpperMac(Pdu data, MacLogicalChannel macLogicalChannel)
+void Mac::serviceUpperMac(const Pdu & data, MacLogicalChannel macLogicalChannel)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s data = %s\n", "service_upper_mac", macLogicalChannelName(macLogicalChannel).c_str(), data.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s data = %s\n", "service_upper_mac", macLogicalChannelName(macLogicalChannel).c_str(), data.toString().c_str());
 
     // send data to Wireshark if available
     if (m_wireMsg) m_wireMsg->sendMsg(macLogicalChannel, m_tetraTime, data);
@@ -418,13 +808,13 @@ void Mac::serviceUpperMac(Pdu data, MacLogicalChannel macLogicalChannel)
             break;
 
         case TCH_S:                                                             // (TMD) MAC-TRAFFIC PDU full slot
-            m_log->print(LogLevel::NONE, "TCH_S       : TN/FN/MN = %2d/%2d/%2d    dl_usage_marker=%d, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, m_macState.downlinkUsageMarker, m_usageMarkerEncryptionMode[m_macState.downlinkUsageMarker]);
+            LOG_PRINT(m_log, LogLevel::NONE, "TCH_S       : TN/FN/MN = %2d/%2d/%2d    dl_usage_marker=%d, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, m_macState.downlinkUsageMarker, m_usageMarkerEncryptionMode[m_macState.downlinkUsageMarker]);
             txt = "  tch_s";
             m_uPlane->service(pdu, TCH_S, m_tetraTime, m_macAddress, m_macState, m_usageMarkerEncryptionMode[(uint8_t)m_macState.downlinkUsageMarker]);
             break;
 
         case TCH:                                                               // TCH half-slot TODO not taken into account for now
-            m_log->print(LogLevel::NONE, "TCH         : TN/FN/MN = %2d/%2d/%2d    dl_usage_marker=%d, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, m_macState.downlinkUsageMarker, m_usageMarkerEncryptionMode[m_macState.downlinkUsageMarker]);
+            LOG_PRINT(m_log, LogLevel::NONE, "TCH         : TN/FN/MN = %2d/%2d/%2d    dl_usage_marker=%d, encr=%u\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, m_macState.downlinkUsageMarker, m_usageMarkerEncryptionMode[m_macState.downlinkUsageMarker]);
             txt = "  tch";
             m_uPlane->service(pdu, TCH, m_tetraTime, m_macAddress, m_macState, m_usageMarkerEncryptionMode[(uint8_t)m_macState.downlinkUsageMarker]);
             break;
@@ -494,12 +884,12 @@ void Mac::serviceUpperMac(Pdu data, MacLogicalChannel macLogicalChannel)
                 {
                     txt = "MAC-D-BLCK";                                         // 21.4.1 not sent on SCH/HD or STCH
                     tmSdu = pduProcessDBlock(pdu, &pduSizeInMac);
-                    m_log->print(LogLevel::NONE, "%-10s : TN/FN/MN = %2d/%2d/%2d\n", txt.c_str(), m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn);
+                    LOG_PRINT(m_log, LogLevel::NONE, "%-10s : TN/FN/MN = %2d/%2d/%2d\n", txt.c_str(), m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn);
                 }
                 else
                 {
                     txt = "MAC-ERROR";
-                    m_log->print(LogLevel::NONE, "MAC error   : TN/FN/MN = %2d/%2d/%2d    supplementary block on channel %d\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, macLogicalChannel);
+                    LOG_PRINT(m_log, LogLevel::NONE, "MAC error   : TN/FN/MN = %2d/%2d/%2d    supplementary block on channel %d\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, macLogicalChannel);
                 }
                 break;
 
@@ -602,9 +992,9 @@ int32_t Mac::decodeLength(uint32_t val)
  *
  */
 
-void Mac::pduProcessAach(Pdu pdu)
+void Mac::pduProcessAach(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_aach", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_aach", pdu.toString().c_str());
 
     uint8_t pos = 0;
     uint8_t header = pdu.getValue(pos, 2);
@@ -661,7 +1051,7 @@ void Mac::pduProcessAach(Pdu pdu)
  *
  */
 
-Pdu Mac::removeFillBits(const Pdu pdu)
+Pdu Mac::removeFillBits(const Pdu & pdu)
 {
     Pdu ret = pdu;
 
@@ -705,9 +1095,9 @@ Pdu Mac::removeFillBits(const Pdu pdu)
  */
 // MAC-RESOURCE 00 00000 000010 000 100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
 
-Pdu Mac::pduProcessResource(Pdu mac_pdu, MacLogicalChannel macLogicalChannel, bool * fragmentedPacketFlag, int32_t * pduSizeInMac)
+Pdu Mac::pduProcessResource(const Pdu & mac_pdu, MacLogicalChannel macLogicalChannel, bool * fragmentedPacketFlag, int32_t * pduSizeInMac)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_resource", mac_pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_resource", mac_pdu.toString().c_str());
 
     Pdu pdu = mac_pdu;
 
@@ -933,9 +1323,9 @@ Pdu Mac::pduProcessResource(Pdu mac_pdu, MacLogicalChannel macLogicalChannel, bo
  *
  */
 
-void Mac::pduProcessMacFrag(Pdu mac_pdu)
+void Mac::pduProcessMacFrag(const Pdu & mac_pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_mac_frag", mac_pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_mac_frag", mac_pdu.toString().c_str());
 
     Pdu pdu = mac_pdu;
 
@@ -964,9 +1354,9 @@ void Mac::pduProcessMacFrag(Pdu mac_pdu)
  *
  */
 
-Pdu Mac::pduProcessMacEnd(Pdu mac_pdu)
+Pdu Mac::pduProcessMacEnd(const Pdu & mac_pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_mac_end", mac_pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_mac_end", mac_pdu.toString().c_str());
 
     Pdu pdu = mac_pdu;
 
@@ -1053,9 +1443,9 @@ Pdu Mac::pduProcessMacEnd(Pdu mac_pdu)
  *
  */
 
-Pdu Mac::pduProcessSysinfo(Pdu pdu, int32_t * pduSizeInMac)
+Pdu Mac::pduProcessSysinfo(const Pdu & pdu, int32_t * pduSizeInMac)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_sysinfo", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_sysinfo", pdu.toString().c_str());
 
     Pdu sdu;
     *pduSizeInMac = 0;
@@ -1127,9 +1517,9 @@ Pdu Mac::pduProcessSysinfo(Pdu pdu, int32_t * pduSizeInMac)
  *
  */
 
-Pdu Mac::pduProcessDBlock(Pdu mac_pdu, int32_t * pduSizeInMac)
+Pdu Mac::pduProcessDBlock(const Pdu & mac_pdu, int32_t * pduSizeInMac)
 {
-    m_log->print(LogLevel::HIGH,"DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_d_block", mac_pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH,"DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_d_block", mac_pdu.toString().c_str());
 
     Pdu pdu = mac_pdu;
     Pdu sdu;
@@ -1178,9 +1568,9 @@ Pdu Mac::pduProcessDBlock(Pdu mac_pdu, int32_t * pduSizeInMac)
  *
  */
 
-Pdu Mac::pduProcessSync(Pdu pdu)
+Pdu Mac::pduProcessSync(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_sync", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_sync", pdu.toString().c_str());
 
     Pdu sdu;
 
@@ -1210,7 +1600,7 @@ Pdu Mac::pduProcessSync(Pdu pdu)
 
         if ((m_tetraTime.fn == 18) && (((m_tetraTime.mn + m_tetraTime.tn) % 4) == 3))
         {
-            m_log->print(LogLevel::NONE, "BSCH        : TN/FN/MN = %2u/%2u/%2u  MAC-SYNC              ColorCode=%3d  LA=%3d  MCC/MNC = %3u/ %3u  Freq= %10.6f MHz  burst=%u\n",
+            LOG_PRINT(m_log, LogLevel::NONE, "BSCH        : TN/FN/MN = %2u/%2u/%2u  MAC-SYNC              ColorCode=%3d  LA=%3d  MCC/MNC = %3u/ %3u  Freq= %10.6f MHz  burst=%u\n",
                    m_tetraTime.tn,
                    m_tetraTime.fn,
                    m_tetraTime.mn,
@@ -1219,7 +1609,7 @@ Pdu Mac::pduProcessSync(Pdu pdu)
                    m_tetraCell->mcc(),
                    m_tetraCell->mnc(),
                    m_tetraCell->downlinkFrequency() / 1.0e6,
-                   curBurstType);
+                   m_curBurstType);
         }
 
         sdu = Pdu(pdu, pos, 29);
@@ -1238,9 +1628,9 @@ Pdu Mac::pduProcessSync(Pdu pdu)
  *
  */
 
-void Mac::pduProcessAccessDefine(Pdu mac_pdu, int32_t * pduSizeInMac)
+void Mac::pduProcessAccessDefine(const Pdu & mac_pdu, int32_t * pduSizeInMac)
 {
-    m_log->print(LogLevel::HIGH,"DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_access_define", mac_pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH,"DEBUG ::%-44s - pdu = %s\n", "mac_pdu_process_access_define", mac_pdu.toString().c_str());
 
     Pdu pdu = mac_pdu;
     Pdu sdu;
@@ -1,7 +1,11 @@
 #ifndef MAC_H
 #define MAC_H
+#include "../common/alloccount.h"
+#include "../common/crc.h"
 #include "../common/tetra.h"
 #include "../common/tetracell.h"
+#include "../common/scrambling.h"
+#include "../common/span.h"
 #include "../common/layer.h"
 #include "../common/log.h"
 #include "../common/report.h"
@@ -10,11 +14,132 @@
 #include "../mle/mle.h"
 #include "../uplane/uplane.h"
 #include "../wiremsg/wiremsg.h"
-#include "viterbi.h"
+#include "broadcastcache.h"
+#include "viterbicodec.h"
 #include "macdefrag.h"
 
 namespace Tetra {
 
+    /**
+     * @brief Decoded block stored in place, empty when not decoded
+     *
+     */
+
+    template <std::size_t N>
+    struct DecodedBlock {
+        uint8_t bits[N];                                                        ///< Decoded bits
+        std::size_t len;                                                        ///< Decoded bits count, 0 when not decoded
+
+        void assign(Span<const uint8_t> val)
+        {
+            std::copy(val.begin(), val.end(), bits);
+            len = val.size();
+        }
+
+        Span<const uint8_t> view() const
+        {
+            return Span<const uint8_t>(bits, len);
+        }
+    };
+
+    /**
+     * @brief Burst blocks selection for channel decoding, see Mac::decodeBurst()
+     *
+     */
+
+    enum DecodeBlocks {
+        DECODE_AACH  = 0x01,                                                    ///< BBK (AACH)
+        DECODE_BSCH  = 0x02,                                                    ///< SB BKN1 (BSCH)
+        DECODE_BKN   = 0x04,                                                    ///< SB BKN2, NDB_SF BKN1 and BKN2, NDB traffic block
+        DECODE_SCH_F = 0x08,                                                    ///< NDB BKN1 as SCH/F
+        DECODE_ALL   = 0x0F
+    };
+
+    /**
+     * @brief Channel decoding policy, FEC is skipped for blocks which won't be used
+     *
+     */
+
+    struct DecodePolicy {
+        uint8_t timeslots;                                                      ///< Time slots to decode, bit (tn - 1) is set for TN 1..4
+        bool bTraffic;                                                          ///< Send traffic channel (TCH) to User plane
+        bool bSkipIdle;                                                         ///< Skip slots which AACH marks as unallocated or reserved
+    };
+
+    /**
+     * @brief Bursts whose BKN blocks were not decoded due to decoding policy
+     *
+     */
+
+    struct DecodeSkipCounters {
+        uint64_t unallocated;                                                   ///< Unallocated slots (AACH)
+        uint64_t reserved;                                                      ///< Reserved slots (AACH)
+        uint64_t timeslot;                                                      ///< Time slot excluded by policy
+        uint64_t traffic;                                                       ///< Traffic excluded by policy
+    };
+
+    /**
+     * @brief Burst blocks after channel decoding (lower MAC), before any upper MAC processing
+     *
+     * Produced by Mac::decodeBurst() which doesn't depend on the MAC state, so it can run
+     * on FEC worker threads. Blocks are stored in place (no heap allocation) and are empty
+     * when not decoded. Blocks not decoded yet can be added with Mac::decodeBurstBlocks().
+     *
+     */
+
+    struct DecodedBurst {
+        int burstType;                                                          ///< Burst type
+        uint32_t scramblingCode;                                                ///< Scrambling code used to decode BBK, BKN1 (except BSCH) and BKN2
+        DecodedBlock<14>  bbk;                                                  ///< AACH after Reed-Muller decoding
+        DecodedBlock<268> bkn1;                                                 ///< BKN1 after Viterbi decoding (BSCH, SCH/F or SCH/HD)
+        DecodedBlock<124> bkn2;                                                 ///< BKN2 after Viterbi decoding (SCH/HD)
+        DecodedBlock<432> tch;                                                  ///< NDB descrambled BKN1 + BKN2 for traffic mode
+        int decodedBlocks;                                                      ///< DecodeBlocks already decoded
+        bool bkn1CrcValid;                                                      ///< BKN1 CRC is valid
+        bool bkn2CrcValid;                                                      ///< BKN2 CRC is valid
+    };
+
+    /**
+     * @brief Channel decoding scratch buffers, one per thread reused across bursts
+     *
+     */
+
+    struct BurstScratch {
+        static const std::size_t MAX_BLOCK_LEN   = 432;                         ///< Longest type-5 block (SCH/F)
+        static const std::size_t MAX_MOTHER_LEN  = 4 * MAX_BLOCK_LEN * 2 / 3;   ///< Longest depunctured mother code block
+        static const std::size_t MAX_DECODED_LEN = MAX_MOTHER_LEN / 4;          ///< Longest Viterbi output (type-2 bits + tail bits)
+
+        bool    bSoft;                                                          ///< Soft bits are used for decoding
+        uint8_t block[MAX_BLOCK_LEN];                                           ///< Descrambled type-5 bits (hard decision when soft)
+        int8_t  softBlock[MAX_BLOCK_LEN];                                       ///< Descrambled soft type-5 bits
+        uint8_t mother[MAX_MOTHER_LEN];                                         ///< Depunctured mother code bits
+        int8_t  softMother[MAX_MOTHER_LEN];                                     ///< Depunctured soft mother code bits
+        uint8_t decoded[MAX_DECODED_LEN];                                       ///< Viterbi output
+    };
+
+    /**
+     * @brief Depunctured control blocks of the same length, Viterbi decoded together one block per SIMD lane
+     *
+     * Filled by Mac::decodeBurstsBlocks(), decoded by Mac::decodeControlBlocks() which gives the
+     * CRC result of each block.
+     *
+     */
+
+    struct ControlBlockBatch {
+        static const std::size_t LANES = ViterbiCodec1614::BATCH_LANES;
+
+        uint32_t K;                                                             ///< Type-5 block length (216 for SCH/HD or BNCH, 432 for SCH/F)
+        uint32_t a;                                                             ///< Interleaving parameter of the block length
+        bool     bSoft;                                                         ///< Blocks are soft bits
+        std::size_t count;                                                      ///< Blocks count
+        uint8_t mother[LANES][BurstScratch::MAX_MOTHER_LEN];                    ///< Depunctured mother code bits of each block
+        int8_t  softMother[LANES][BurstScratch::MAX_MOTHER_LEN];                ///< Depunctured soft mother code bits of each block
+        uint8_t decoded[LANES][BurstScratch::MAX_DECODED_LEN];                  ///< Viterbi output of each block
+        bool    crcValid[LANES];                                                ///< CRC result of each block
+        DecodedBurst * bursts[LANES];                                           ///< Burst receiving each block
+        bool    bBkn2[LANES];                                                   ///< Block is BKN2 of its burst, otherwise BKN1
+    };
+
     /**
      * @brief MAC layers class
      *
@@ -28,9 +153,35 @@ namespace Tetra {
         void incrementTn();
         TetraTime getTime();
 
-        void serviceLowerMac(std::vector<uint8_t> data, int burst_type);
+        void serviceLowerMac(const uint8_t * data, int burst_type, const int8_t * softData = NULL);
+        void serviceDecodedBurst(DecodedBurst & burst, const uint8_t * data, const int8_t * softData = NULL);
+
+        void setDecodePolicy(const DecodePolicy & policy);
+        DecodeSkipCounters getDecodeSkipCounters();
+
+        static void decodeBurst(const uint8_t * data, const int8_t * softData, const int burstType, const uint32_t scramblingCode, const int blocks, DecodedBurst * res);
+        static void decodeBurstBlocks(const uint8_t * data, const int8_t * softData, const int blocks, DecodedBurst * res);
+        static void decodeBurstsBlocks(const uint8_t * const * data, const int8_t * const * softData, const int blocks, DecodedBurst * const * res, const std::size_t count);
+        static void decodeControlBlocks(ControlBlockBatch * batch);
+        static bool isIdleAach(const DecodedBurst & burst);
         std::string burstName(int val);
 
+        // decoding functions per clause 8, stateless so they can run on any thread, working on caller buffers
+        static const ViterbiCodec1614 * viterbiCodec1614();
+        static void descramble(Span<const uint8_t> data, Span<uint8_t> res, const uint32_t scramblingCode);
+        static void deinterleaveDepuncture23(Span<const uint8_t> data, const uint32_t K, const uint32_t a, Span<uint8_t> res);
+        static void viterbiDecode1614(Span<const uint8_t> data, Span<uint8_t> res);
+        static void viterbiDecode1614Batch(const uint8_t * const * data, const std::size_t count, const std::size_t len, uint8_t * const * res);
+        static void reedMuller3014Decode(Span<const uint8_t> data, Span<uint8_t> res);
+        static bool checkCrc16Ccitt(Span<const uint8_t> data, const int len);
+
+        // soft-decision decoding functions, soft bit > 0 is 1, < 0 is 0, 0 is erasure
+        static void descramble(Span<const int8_t> data, Span<int8_t> res, const uint32_t scramblingCode);
+        static void deinterleaveDepuncture23(Span<const int8_t> data, const uint32_t K, const uint32_t a, Span<int8_t> res);
+        static void viterbiDecode1614(Span<const int8_t> data, Span<uint8_t> res);
+        static void viterbiDecode1614Batch(const int8_t * const * data, const std::size_t count, const std::size_t len, uint8_t * const * res);
+        static void reedMuller3014Decode(Span<const int8_t> data, Span<uint8_t> res);
+
     private:
         TetraCell * m_tetraCell;                                                ///< Tetra cell informations
 
@@ -46,29 +197,33 @@ namespace Tetra {
         uint8_t m_usageMarkerEncryptionMode[64];                                ///< Usage marker encryption mode for U-Plane (MAC TRAFFIC)
 
         uint8_t m_secondSlotStolenFlag;                                         ///< 1 if second slot is stolen
+        int m_curBurstType;                                                     ///< Burst type being processed
         bool m_bRemoveFillBits;                                                 ///< Remove filling bits flags
-        Pdu removeFillBits(const Pdu pdu);
+        DecodePolicy m_decodePolicy;                                            ///< Channel decoding policy
+        DecodeSkipCounters m_decodeSkipCounters;                                ///< Bursts with skipped channel decoding
+        void completeBurst(DecodedBurst * burst, const uint8_t * data, const int8_t * softData, const int blocks);
+        bool skipBurstBlocks();
+        Pdu removeFillBits(const Pdu & pdu);
         int32_t decodeLength(uint32_t val);
 
-        // decoding functions per clause 8
-        ViterbiCodec * m_viterbiCodec1614;                                      ///< Viterbi codec
-        std::vector<uint8_t> descramble(std::vector<uint8_t> data, const int len, const uint32_t scramblingCode);
-        std::vector<uint8_t> deinterleave(std::vector<uint8_t> data, const uint32_t K, const uint32_t a);
-        std::vector<uint8_t> depuncture23(std::vector<uint8_t> data, const uint32_t len);
-        std::vector<uint8_t> viterbiDecode1614(std::vector<uint8_t> data);
-        std::vector<uint8_t> reedMuller3014Decode(std::vector<uint8_t> data);
-        int checkCrc16Ccitt(std::vector<uint8_t> data, const int len);
-
-        void serviceUpperMac(const Pdu data, MacLogicalChannel macLogicalChannel);
-
-        Pdu  pduProcessSync(const Pdu pdu);                                                                                               // process SYNC
-        void pduProcessAach(const Pdu data);                                                                                              // process ACCESS-ASSIGN - no SDU
-        Pdu  pduProcessResource(const Pdu pdu, MacLogicalChannel macLogicalChannel, bool * fragmentedPacketFlag, int32_t * pduSizeInMac); // process MAC-RESOURCE
-        Pdu  pduProcessSysinfo(const Pdu pdu, int32_t * pduSizeInMac);                                                                    // process SYSINFO
-        void pduProcessMacFrag(const Pdu pdu);                                                                                            // process MAC-FRAG
-        Pdu  pduProcessMacEnd(const Pdu pdu);                                                                                             // process MAC-END
-        Pdu  pduProcessDBlock(const Pdu pdu, int32_t * pduSizeInMac);                                                                     // process MAC-D-BLCK
-        void pduProcessAccessDefine(const Pdu pdu, int32_t * pduSizeInMac);                                                               // process ACCESS-DEFINE - no SDU
+        // burst blocks decoding chains on scratch buffers
+        static void extractBlock(const uint8_t * data, const int8_t * softData, const uint32_t pos1, const uint32_t len1, const uint32_t pos2, const uint32_t len2, const uint32_t scramblingCode, BurstScratch * scratch);
+        static void decodeAach(const BurstScratch * scratch, Span<uint8_t> res);
+        static Span<const uint8_t> decodeControlBlock(BurstScratch * scratch, const uint32_t K, const uint32_t a);
+        static Span<const uint8_t> decodeBroadcastBlock(BurstScratch * scratch, const uint32_t K, const uint32_t a, bool * crcValid);
+        static void queueControlBlock(const BurstScratch * scratch, DecodedBurst * burst, const bool bBkn2, ControlBlockBatch * batch);
+        static void flushControlBlocks(ControlBlockBatch * batch);
+
+        void serviceUpperMac(const Pdu & data, MacLogicalChannel macLogicalChannel);
+
+        Pdu  pduProcessSync(const Pdu & pdu);                                                                                               // process SYNC
+        void pduProcessAach(const Pdu & data);                                                                                              // process ACCESS-ASSIGN - no SDU
+        Pdu  pduProcessResource(const Pdu & pdu, MacLogicalChannel macLogicalChannel, bool * fragmentedPacketFlag, int32_t * pduSizeInMac); // process MAC-RESOURCE
+        Pdu  pduProcessSysinfo(const Pdu & pdu, int32_t * pduSizeInMac);                                                                    // process SYSINFO
+        void pduProcessMacFrag(const Pdu & pdu);                                                                                            // process MAC-FRAG
+        Pdu  pduProcessMacEnd(const Pdu & pdu);                                                                                             // process MAC-END
+        Pdu  pduProcessDBlock(const Pdu & pdu, int32_t * pduSizeInMac);                                                                     // process MAC-D-BLCK
+        void pduProcessAccessDefine(const Pdu & pdu, int32_t * pduSizeInMac);                                                               // process ACCESS-DEFINE - no SDU
     };
 
 };
@@ -73,7 +73,7 @@ void MacDefrag::start(const MacAddress address, const TetraTime timeSlot)
  *
  */
 
-void MacDefrag::append(Pdu sdu, const MacAddress address)
+void MacDefrag::append(const Pdu & sdu, const MacAddress address)
 {
     if (b_stopped)                                                              // we can't append if in stopped mode
     {
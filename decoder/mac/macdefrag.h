@@ -40,7 +40,7 @@ namespace Tetra {
         TetraTime  startTime;                                                   // start time of defragemnter (will be used to stop on missing/invalid end frag packet receive)
 
         void start(const MacAddress address, const TetraTime timeSlot);
-        void append(Pdu sdu, const MacAddress address);
+        void append(const Pdu & sdu, const MacAddress address);
         void stop();
 
         Pdu getSdu(uint8_t * encryptionMode, uint8_t * usageMarker);
@@ -0,0 +1,763 @@
+#ifndef VITERBICODEC_H
+#define VITERBICODEC_H
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @defgroup tetra_mac Rate 1/4 convolutional codec
+ *
+ * @{
+ *
+ */
+
+namespace Tetra {
+
+    /**
+     * @brief Convolutional encoder and hard-decision Viterbi decoder of rate 1/4
+     *
+     * Constraint length K and generator polynomials are template parameters, so the
+     * trellis is fixed at compile time. Polynomial bit i is the coefficient of D^i,
+     * eg. G = 1 + D + D^4 -> 0b10011.
+     *
+     * State is the K - 1 previous input bits, newest as MSB. Path metrics are kept
+     * in fixed arrays and survivor decisions are packed as one bit per state and
+     * per symbol, there is no allocation while decoding.
+     *
+     * Decoder input is one bit per byte: 0, 1 or ERASURE for erased bits (no
+     * contribution to branch metrics), as inserted by depuncturing.
+     *
+     * Ties are resolved towards the predecessor with oldest bit 0, and traceback
+     * starts from the first state with the best metric.
+     *
+     * For the 16 states codes, add-compare-select runs on SSE2 with 16-bits
+     * metrics (8 states per register) when available, with the same results as
+     * the scalar implementation. Many blocks of the same length can also be
+     * decoded at once by decodeBatch(), one block per 8-bits SIMD lane, or with
+     * soft bits by decodeSoftBatch(), one block per 16-bits SIMD lane.
+     *
+     */
+
+    template <unsigned K, uint32_t G1, uint32_t G2, uint32_t G3, uint32_t G4, std::size_t MAX_SYMBOLS = 512>
+    class Rate14ViterbiCodec {
+        static_assert((K >= 3) && (K <= 6), "Rate14ViterbiCodec constraint length must be 3..6");
+
+    public:
+        static const uint32_t STATES_COUNT = 1u << (K - 1);                     ///< Trellis states
+        static const uint8_t  ERASURE      = 2;                                 ///< Erased input bit value
+        static const uint32_t UNREACHABLE  = 0x2000;                            ///< Initial metric of states other than 0
+
+        static const std::size_t BATCH_LANES = 16;                              ///< Blocks decoded at once by decodeBatch() and decodeSoftBatch()
+
+        static_assert(UNREACHABLE + 4 * MAX_SYMBOLS < 0x7fff, "Rate14ViterbiCodec metrics must fit in 16 bits");
+
+        typedef typename std::conditional<(STATES_COUNT <= 16), uint16_t, uint32_t>::type DecisionWord;
+
+        Rate14ViterbiCodec()
+        {
+            for (uint32_t reg = 0; reg < 2 * STATES_COUNT; reg++)               // register = current input (MSB) + state
+            {
+                m_outputs[reg] = (uint8_t)((parity(reg & reverseBits(G1, K)) << 3) |
+                                           (parity(reg & reverseBits(G2, K)) << 2) |
+                                           (parity(reg & reverseBits(G3, K)) << 1) |
+                                           (parity(reg & reverseBits(G4, K)) << 0));
+            }
+
+            // branch metrics of 16 states trellis per received symbol (3^4 combinations of 0, 1 and erasure),
+            // in the SIMD lanes order: [input][predecessor >> 3][predecessor & 7]
+            for (uint32_t rx = 0; rx < 81; rx++)
+            {
+                for (uint32_t reg = 0; reg < 32; reg++)
+                {
+                    uint32_t val  = rx;
+                    uint32_t cost = 0;
+                    for (uint32_t idx = 0; (idx < 4) && (STATES_COUNT == 16); idx++)
+                    {
+                        uint32_t bit = val % 3;
+                        val /= 3;
+                        if ((bit < ERASURE) && (bit != ((uint32_t)(m_outputs[reg & (2 * STATES_COUNT - 1)] >> (3 - idx)) & 0x01)))
+                        {
+                            cost++;
+                        }
+                    }
+                    m_branchCosts[rx][reg >> 3][reg & 0x07] = (int16_t)cost;
+                }
+            }
+        }
+
+        /**
+         * @brief Encode len bits into 4 * len bits, starting from state 0
+         *
+         * No flushing bits are added, tail bits are part of the input block.
+         *
+         */
+
+        void encode(const uint8_t * in, const std::size_t len, uint8_t * out) const
+        {
+            uint32_t state = 0;
+
+            for (std::size_t idx = 0; idx < len; idx++)
+            {
+                uint32_t reg = ((uint32_t)(in[idx] & 0x01) << (K - 1)) | state;
+                uint8_t  sym = m_outputs[reg];
+
+                out[4 * idx + 0] = (sym >> 3) & 0x01;
+                out[4 * idx + 1] = (sym >> 2) & 0x01;
+                out[4 * idx + 2] = (sym >> 1) & 0x01;
+                out[4 * idx + 3] = (sym >> 0) & 0x01;
+
+                state = reg >> 1;
+            }
+        }
+
+        /**
+         * @brief Decode len received bits (4 per symbol), starting from state 0
+         *
+         * @param in   Received bits, 0, 1 or erasure
+         * @param len  Received bits count, an incomplete last symbol is ignored
+         * @param out  Decoded bits, len / 4 values (at most MAX_SYMBOLS)
+         *
+         * @return Decoded bits count
+         *
+         */
+
+        std::size_t decode(const uint8_t * in, const std::size_t len, uint8_t * out) const
+        {
+#if defined(__SSE2__)
+            if (STATES_COUNT == 16)
+            {
+                return decodeSse2(in, len, out);
+            }
+#endif
+            return decodeScalar(in, len, out);
+        }
+
+        /**
+         * @brief Portable decoder, reference for the SIMD one
+         *
+         */
+
+        std::size_t decodeScalar(const uint8_t * in, const std::size_t len, uint8_t * out) const
+        {
+            std::size_t symbols = len / 4;
+            if (symbols > MAX_SYMBOLS)
+            {
+                symbols = MAX_SYMBOLS;
+            }
+
+            uint32_t metrics[STATES_COUNT];
+            uint32_t newMetrics[STATES_COUNT];
+            DecisionWord decisions[MAX_SYMBOLS];
+
+            for (uint32_t state = 0; state < STATES_COUNT; state++)
+            {
+                metrics[state] = UNREACHABLE;
+            }
+            metrics[0] = 0;
+
+            for (std::size_t sym = 0; sym < symbols; sym++)
+            {
+                // received symbol and mask of non erased bits, in the same order as the output table
+                uint32_t rx   = 0;
+                uint32_t mask = 0;
+                for (uint32_t idx = 0; idx < 4; idx++)
+                {
+                    uint8_t bit = in[4 * sym + idx];
+                    if (bit < ERASURE)
+                    {
+                        rx   |= (uint32_t)bit << (3 - idx);
+                        mask |= 1u << (3 - idx);
+                    }
+                }
+
+                uint32_t cost[16];                                              // Hamming distance per possible output symbol
+                for (uint32_t val = 0; val < 16; val++)
+                {
+                    cost[val] = (uint32_t)__builtin_popcount((val ^ rx) & mask);
+                }
+
+                DecisionWord decision = 0;
+
+                for (uint32_t state = 0; state < STATES_COUNT; state++)
+                {
+                    const uint32_t input = state >> (K - 2);
+                    const uint32_t prev0 = (state << 1) & (STATES_COUNT - 1);    // predecessor with oldest bit 0
+                    const uint32_t prev1 = prev0 | 1;                           // predecessor with oldest bit 1
+
+                    uint32_t metric0 = metrics[prev0] + cost[m_outputs[(input << (K - 1)) | prev0]];
+                    uint32_t metric1 = metrics[prev1] + cost[m_outputs[(input << (K - 1)) | prev1]];
+
+                    if (metric0 <= metric1)
+                    {
+                        newMetrics[state] = metric0;
+                    }
+                    else
+                    {
+                        newMetrics[state] = metric1;
+                        decision |= (DecisionWord)(1u << state);
+                    }
+                }
+
+                for (uint32_t state = 0; state < STATES_COUNT; state++)
+                {
+                    metrics[state] = newMetrics[state];
+                }
+                decisions[sym] = decision;
+            }
+
+            traceback(metrics, decisions, symbols, out);
+
+            return symbols;
+        }
+
+#if defined(__SSE2__)
+        /**
+         * @brief 16 states decoder, add-compare-select of 8 states per SSE2 register
+         *
+         * New states s < 8 (input 0) and s + 8 (input 1) have the same predecessors 2s and
+         * 2s + 1, which are the two 16-bits halves of a 32-bits lane of the metrics. Branch
+         * metrics are added to both halves, then the min of each 32-bits lane gives the new
+         * metric in its low half and 0 in its high half, so packing 32 -> 16 bits directly
+         * gives the new metrics in state order without any shuffle.
+         *
+         */
+
+        std::size_t decodeSse2(const uint8_t * in, const std::size_t len, uint8_t * out) const
+        {
+            std::size_t symbols = len / 4;
+            if (symbols > MAX_SYMBOLS)
+            {
+                symbols = MAX_SYMBOLS;
+            }
+
+            DecisionWord decisions[MAX_SYMBOLS];
+
+            const __m128i lowHalf = _mm_set1_epi32(0x0000ffff);
+
+            __m128i metricsLo = _mm_set_epi16(UNREACHABLE, UNREACHABLE, UNREACHABLE, UNREACHABLE, UNREACHABLE, UNREACHABLE, UNREACHABLE, 0); // states 0..7
+            __m128i metricsHi = _mm_set1_epi16(UNREACHABLE);                                                                              // states 8..15
+
+            for (std::size_t sym = 0; sym < symbols; sym++)
+            {
+                uint32_t bits;
+                memcpy(&bits, in + 4 * sym, 4);
+                const uint32_t rx = (bits * 0x0103091b) >> 24;                  // b0 + 3 * b1 + 9 * b2 + 27 * b3 (little endian), no carry since b <= 2
+                const __m128i * cost = (const __m128i *)m_branchCosts[rx];
+
+                __m128i path0 = _mm_add_epi16(metricsLo, _mm_load_si128(cost + 0)); // new states 0..3 from 0..7
+                __m128i path1 = _mm_add_epi16(metricsHi, _mm_load_si128(cost + 1)); // new states 4..7 from 8..15
+                __m128i path2 = _mm_add_epi16(metricsLo, _mm_load_si128(cost + 2)); // new states 8..11 from 0..7
+                __m128i path3 = _mm_add_epi16(metricsHi, _mm_load_si128(cost + 3)); // new states 12..15 from 8..15
+
+                metricsLo = _mm_packs_epi32(_mm_min_epi16(path0, _mm_srli_epi32(path0, 16)), _mm_min_epi16(path1, _mm_srli_epi32(path1, 16)));
+                metricsHi = _mm_packs_epi32(_mm_min_epi16(path2, _mm_srli_epi32(path2, 16)), _mm_min_epi16(path3, _mm_srli_epi32(path3, 16)));
+
+                // odd predecessor only when strictly better than the even one
+                __m128i decisionLo = _mm_cmpgt_epi16(_mm_packs_epi32(_mm_and_si128(path0, lowHalf), _mm_and_si128(path1, lowHalf)), metricsLo);
+                __m128i decisionHi = _mm_cmpgt_epi16(_mm_packs_epi32(_mm_and_si128(path2, lowHalf), _mm_and_si128(path3, lowHalf)), metricsHi);
+                decisions[sym] = (DecisionWord)_mm_movemask_epi8(_mm_packs_epi16(decisionLo, decisionHi));
+            }
+
+            alignas(16) int16_t values[16];
+            _mm_store_si128((__m128i *)values,       metricsLo);
+            _mm_store_si128((__m128i *)(values + 8), metricsHi);
+
+            uint32_t metrics[STATES_COUNT];
+            for (uint32_t state = 0; state < STATES_COUNT; state++)
+            {
+                metrics[state] = (uint32_t)values[state];
+            }
+
+            traceback(metrics, decisions, symbols, out);
+
+            return symbols;
+        }
+#endif
+
+        /**
+         * @brief Decode count blocks of len received bits each, one block per SIMD lane
+         *
+         * Same results as decode() called on each block, count must be at most BATCH_LANES.
+         *
+         * @param in     Received bits of each block, 0, 1 or erasure
+         * @param count  Blocks count
+         * @param len    Received bits count per block
+         * @param out    Decoded bits of each block, len / 4 values (at most MAX_SYMBOLS)
+         *
+         * @return Decoded bits count per block
+         *
+         */
+
+        std::size_t decodeBatch(const uint8_t * const * in, const std::size_t count, const std::size_t len, uint8_t * const * out) const
+        {
+#if defined(__SSE2__)
+            if (STATES_COUNT == 16)
+            {
+                return decodeBatchSse2(in, count, len, out);
+            }
+#endif
+            std::size_t symbols = 0;
+            for (std::size_t idx = 0; idx < count; idx++)
+            {
+                symbols = decode(in[idx], len, out[idx]);
+            }
+
+            return symbols;
+        }
+
+#if defined(__SSE2__)
+        /**
+         * @brief 16 states decoder of 16 blocks at once, one block per 8-bits lane
+         *
+         * Metrics are renormalized every 16 symbols (minimum of each lane is subtracted)
+         * so they fit in unsigned bytes: spread between states is at most 16 once all states
+         * are reached, and they grow by at most 4 per symbol. States other than 0 start with
+         * a metric of 64 which can't win against paths from state 0 during the first 4 symbols,
+         * so decisions are the same as with the scalar decoder.
+         *
+         */
+
+        std::size_t decodeBatchSse2(const uint8_t * const * in, const std::size_t count, const std::size_t len, uint8_t * const * out) const
+        {
+            std::size_t symbols = len / 4;
+            if (symbols > MAX_SYMBOLS)
+            {
+                symbols = MAX_SYMBOLS;
+            }
+
+            const uint8_t * rows[BATCH_LANES];                                  // missing lanes decode the first block again
+            for (std::size_t lane = 0; lane < BATCH_LANES; lane++)
+            {
+                rows[lane] = in[lane < count ? lane : 0];
+            }
+
+            __m128i decisions[MAX_SYMBOLS][STATES_COUNT / 8];                   // lane bit (state & 7) set when predecessor of state has oldest bit 0
+
+            __m128i stateBits[8];                                               // bit of state in its decisions byte
+            for (uint32_t idx = 0; idx < 8; idx++)
+            {
+                stateBits[idx] = _mm_set1_epi8((char)(1 << idx));
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i one  = _mm_set1_epi8(1);
+
+            __m128i received[16];                                               // 4 symbols of each lane, one received bit per register
+
+            __m128i metrics[STATES_COUNT];
+            metrics[0] = zero;
+            for (uint32_t state = 1; state < STATES_COUNT; state++)
+            {
+                metrics[state] = _mm_set1_epi8(64);
+            }
+
+            for (std::size_t sym = 0; sym < symbols; sym++)
+            {
+                if ((sym & 3) == 0)                                             // 4 symbols per transposition
+                {
+                    if ((sym & 15) == 0)
+                    {
+                        __m128i low = metrics[0];
+                        for (uint32_t state = 1; state < STATES_COUNT; state++)
+                        {
+                            low = _mm_min_epu8(low, metrics[state]);
+                        }
+                        for (uint32_t state = 0; state < STATES_COUNT; state++)
+                        {
+                            metrics[state] = _mm_sub_epi8(metrics[state], low);
+                        }
+                    }
+                    loadTransposed(rows, 4 * sym, 4 * symbols, ERASURE, received);
+                }
+
+                // cost of each received bit when output bit is 0 (received 1) or 1 (received 0), erasures cost nothing
+                const __m128i * bits = received + 4 * (sym & 3);
+                const __m128i cost0[4] = {
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[0], one), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[1], one), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[2], one), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[3], one), one)
+                };
+                const __m128i cost1[4] = {
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[0], zero), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[1], zero), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[2], zero), one),
+                    _mm_and_si128(_mm_cmpeq_epi8(bits[3], zero), one)
+                };
+
+                // then per 2 bits pairs and per output symbol
+                const __m128i pairs01[4] = {
+                    _mm_add_epi8(cost0[0], cost0[1]),
+                    _mm_add_epi8(cost0[0], cost1[1]),
+                    _mm_add_epi8(cost1[0], cost0[1]),
+                    _mm_add_epi8(cost1[0], cost1[1])
+                };
+                const __m128i pairs23[4] = {
+                    _mm_add_epi8(cost0[2], cost0[3]),
+                    _mm_add_epi8(cost0[2], cost1[3]),
+                    _mm_add_epi8(cost1[2], cost0[3]),
+                    _mm_add_epi8(cost1[2], cost1[3])
+                };
+                const __m128i cost[16] = {
+                    _mm_add_epi8(pairs01[0], pairs23[0]), _mm_add_epi8(pairs01[0], pairs23[1]), _mm_add_epi8(pairs01[0], pairs23[2]), _mm_add_epi8(pairs01[0], pairs23[3]),
+                    _mm_add_epi8(pairs01[1], pairs23[0]), _mm_add_epi8(pairs01[1], pairs23[1]), _mm_add_epi8(pairs01[1], pairs23[2]), _mm_add_epi8(pairs01[1], pairs23[3]),
+                    _mm_add_epi8(pairs01[2], pairs23[0]), _mm_add_epi8(pairs01[2], pairs23[1]), _mm_add_epi8(pairs01[2], pairs23[2]), _mm_add_epi8(pairs01[2], pairs23[3]),
+                    _mm_add_epi8(pairs01[3], pairs23[0]), _mm_add_epi8(pairs01[3], pairs23[1]), _mm_add_epi8(pairs01[3], pairs23[2]), _mm_add_epi8(pairs01[3], pairs23[3])
+                };
+
+                // butterflies: new states j (input 0) and j + 8 (input 1) have the same predecessors 2j and 2j + 1,
+                // odd predecessor only when strictly better
+                __m128i newMetrics[STATES_COUNT];
+                __m128i even0 = zero;                                           // decisions of states 0..7
+                __m128i even1 = zero;                                           // decisions of states 8..15
+                for (uint32_t idx = 0; idx < STATES_COUNT / 2; idx++)
+                {
+                    const __m128i metric00 = _mm_adds_epu8(metrics[2 * idx],     cost[m_outputs[2 * idx]]);
+                    const __m128i metric01 = _mm_adds_epu8(metrics[2 * idx + 1], cost[m_outputs[2 * idx + 1]]);
+                    const __m128i metric10 = _mm_adds_epu8(metrics[2 * idx],     cost[m_outputs[STATES_COUNT + 2 * idx]]);
+                    const __m128i metric11 = _mm_adds_epu8(metrics[2 * idx + 1], cost[m_outputs[STATES_COUNT + 2 * idx + 1]]);
+
+                    newMetrics[idx]                    = _mm_min_epu8(metric00, metric01);
+                    newMetrics[idx + STATES_COUNT / 2] = _mm_min_epu8(metric10, metric11);
+
+                    even0 = _mm_or_si128(even0, _mm_and_si128(_mm_cmpeq_epi8(newMetrics[idx], metric00), stateBits[idx]));
+                    even1 = _mm_or_si128(even1, _mm_and_si128(_mm_cmpeq_epi8(newMetrics[idx + STATES_COUNT / 2], metric10), stateBits[idx]));
+                }
+
+                decisions[sym][0] = even0;
+                decisions[sym][1] = even1;
+
+                for (uint32_t state = 0; state < STATES_COUNT; state++)
+                {
+                    metrics[state] = newMetrics[state];
+                }
+            }
+
+            // first state with best metric of each lane
+            __m128i best   = metrics[0];
+            __m128i states = zero;
+            for (uint32_t state = 1; state < STATES_COUNT; state++)
+            {
+                const __m128i better = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_min_epu8(metrics[state], best), best), _mm_set1_epi8(-1));
+                best   = _mm_min_epu8(best, metrics[state]);
+                states = _mm_or_si128(_mm_andnot_si128(better, states), _mm_and_si128(better, _mm_set1_epi8((char)state)));
+            }
+
+            tracebackBatch(decisions, symbols, states, count, out);
+
+            return symbols;
+        }
+
+        /**
+         * @brief Soft-decision decoding of count terminated blocks at once, one block per 16-bits lane
+         *
+         * Path metric is the correlation between soft bits and branch outputs (to be maximised),
+         * 2 registers of 8 lanes per state. Metrics wrap around, they are only compared through
+         * their difference which stays far below 16 bits. Ties are resolved towards the predecessor
+         * with oldest bit 0 and traceback starts from state 0 (blocks end with tail bits).
+         * count must be at most BATCH_LANES.
+         *
+         * @param in     Soft bits of each block, > 0 is 1, < 0 is 0, 0 is erasure
+         * @param count  Blocks count
+         * @param len    Soft bits count per block
+         * @param out    Decoded bits of each block, len / 4 values (at most MAX_SYMBOLS)
+         *
+         * @return Decoded bits count per block
+         *
+         */
+
+        std::size_t decodeSoftBatch(const int8_t * const * in, const std::size_t count, const std::size_t len, uint8_t * const * out) const
+        {
+            static_assert(STATES_COUNT == 16, "Rate14ViterbiCodec soft batch decoder is for 16 states codes");
+
+            std::size_t symbols = len / 4;
+            if (symbols > MAX_SYMBOLS)
+            {
+                symbols = MAX_SYMBOLS;
+            }
+
+            const uint8_t * rows[BATCH_LANES];                                  // missing lanes decode the first block again
+            for (std::size_t lane = 0; lane < BATCH_LANES; lane++)
+            {
+                rows[lane] = (const uint8_t *)in[lane < count ? lane : 0];
+            }
+
+            __m128i decisions[MAX_SYMBOLS][STATES_COUNT / 8];                   // lane bit (state & 7) set when predecessor of state has oldest bit 0
+
+            __m128i stateBits[8];                                               // bit of state in its decisions byte
+            for (uint32_t idx = 0; idx < 8; idx++)
+            {
+                stateBits[idx] = _mm_set1_epi8((char)(1 << idx));
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+
+            __m128i received[16];                                               // 4 symbols of each lane, one soft bit per register
+
+            __m128i metricsLo[STATES_COUNT];                                    // lanes 0..7
+            __m128i metricsHi[STATES_COUNT];                                    // lanes 8..15
+            metricsLo[0] = zero;
+            metricsHi[0] = zero;
+            for (uint32_t state = 1; state < STATES_COUNT; state++)
+            {
+                metricsLo[state] = _mm_set1_epi16(-(int16_t)UNREACHABLE);
+                metricsHi[state] = metricsLo[state];
+            }
+
+            for (std::size_t sym = 0; sym < symbols; sym++)
+            {
+                if ((sym & 3) == 0)                                             // 4 symbols per transposition
+                {
+                    loadTransposed(rows, 4 * sym, 4 * symbols, 0, received);
+                }
+
+                // soft bits sign extended to 16 bits, then correlation per output symbol: sum of +/- soft bits,
+                // built from the 2 bits pairs (output bit 1 adds the soft bit, output bit 0 subtracts it)
+                const __m128i * bits = received + 4 * (sym & 3);
+                __m128i bm[2][16];
+                for (uint32_t half = 0; half < 2; half++)
+                {
+                    __m128i val[4];
+                    for (uint32_t idx = 0; idx < 4; idx++)
+                    {
+                        val[idx] = _mm_srai_epi16(half ? _mm_unpackhi_epi8(bits[idx], bits[idx]) : _mm_unpacklo_epi8(bits[idx], bits[idx]), 8);
+                    }
+
+                    const __m128i sum01  = _mm_add_epi16(val[0], val[1]);
+                    const __m128i diff01 = _mm_sub_epi16(val[0], val[1]);
+                    const __m128i sum23  = _mm_add_epi16(val[2], val[3]);
+                    const __m128i diff23 = _mm_sub_epi16(val[2], val[3]);
+
+                    const __m128i pairs01[4] = {_mm_sub_epi16(zero, sum01), _mm_sub_epi16(zero, diff01), diff01, sum01};
+                    const __m128i pairs23[4] = {_mm_sub_epi16(zero, sum23), _mm_sub_epi16(zero, diff23), diff23, sum23};
+
+                    for (uint32_t pattern = 0; pattern < 16; pattern++)
+                    {
+                        bm[half][pattern] = _mm_add_epi16(pairs01[pattern >> 2], pairs23[pattern & 3]);
+                    }
+                }
+
+                // butterflies: new states j (input 0) and j + 8 (input 1) have the same predecessors 2j and 2j + 1,
+                // odd predecessor only when strictly better
+                __m128i newLo[STATES_COUNT];
+                __m128i newHi[STATES_COUNT];
+                __m128i even0 = zero;                                           // decisions of states 0..7
+                __m128i even1 = zero;                                           // decisions of states 8..15
+                for (uint32_t idx = 0; idx < STATES_COUNT / 2; idx++)
+                {
+                    for (uint32_t input = 0; input < 2; input++)
+                    {
+                        const uint32_t state = (input << (K - 2)) | idx;
+                        const uint8_t  out0  = m_outputs[(input << (K - 1)) | (2 * idx)];
+                        const uint8_t  out1  = m_outputs[(input << (K - 1)) | (2 * idx + 1)];
+
+                        const __m128i metric0Lo = _mm_add_epi16(metricsLo[2 * idx], bm[0][out0]);
+                        const __m128i metric0Hi = _mm_add_epi16(metricsHi[2 * idx], bm[1][out0]);
+                        const __m128i diffLo = _mm_sub_epi16(_mm_add_epi16(metricsLo[2 * idx + 1], bm[0][out1]), metric0Lo);
+                        const __m128i diffHi = _mm_sub_epi16(_mm_add_epi16(metricsHi[2 * idx + 1], bm[1][out1]), metric0Hi);
+                        const __m128i oddLo  = _mm_cmpgt_epi16(diffLo, zero);
+                        const __m128i oddHi  = _mm_cmpgt_epi16(diffHi, zero);
+
+                        newLo[state] = _mm_add_epi16(metric0Lo, _mm_and_si128(diffLo, oddLo));
+                        newHi[state] = _mm_add_epi16(metric0Hi, _mm_and_si128(diffHi, oddHi));
+
+                        const __m128i evenBits = _mm_andnot_si128(_mm_packs_epi16(oddLo, oddHi), stateBits[idx]);
+                        if (input)
+                        {
+                            even1 = _mm_or_si128(even1, evenBits);
+                        }
+                        else
+                        {
+                            even0 = _mm_or_si128(even0, evenBits);
+                        }
+                    }
+                }
+
+                decisions[sym][0] = even0;
+                decisions[sym][1] = even1;
+
+                for (uint32_t state = 0; state < STATES_COUNT; state++)
+                {
+                    metricsLo[state] = newLo[state];
+                    metricsHi[state] = newHi[state];
+                }
+            }
+
+            tracebackBatch(decisions, symbols, zero, count, out);
+
+            return symbols;
+        }
+#endif
+
+    private:
+        uint8_t m_outputs[2 * STATES_COUNT];                                    ///< Output symbol (4 bits, G1 as MSB) per register value
+        alignas(16) int16_t m_branchCosts[81][4][8];                            ///< 16 states trellis branch metrics per received symbol
+
+#if defined(__SSE2__)
+        /**
+         * @brief Load 16 bytes at offset of 16 rows, transposed: res[idx] holds byte idx of each row
+         *
+         * Rows shorter than offset + 16 (len) are padded with pad value.
+         *
+         */
+
+        static void loadTransposed(const uint8_t * const * rows, const std::size_t offset, const std::size_t len, const uint8_t pad, __m128i * res)
+        {
+            __m128i val[16];
+
+            for (std::size_t row = 0; row < 16; row++)
+            {
+                if (offset + 16 <= len)
+                {
+                    val[row] = _mm_loadu_si128((const __m128i *)(rows[row] + offset));
+                }
+                else
+                {
+                    alignas(16) uint8_t tail[16];
+                    memset(tail, pad, sizeof(tail));
+                    memcpy(tail, rows[row] + offset, len - offset);
+                    val[row] = _mm_load_si128((const __m128i *)tail);
+                }
+            }
+
+            // 4 rounds of interleaving rows pairs (8, 16, 32 then 64 bits): row r, byte b -> res[b] byte r
+            for (std::size_t round = 0; round < 4; round++)
+            {
+                __m128i tmp[16];
+                for (std::size_t idx = 0; idx < 8; idx++)
+                {
+                    tmp[2 * idx]     = _mm_unpacklo_epi8(val[idx], val[idx + 8]);
+                    tmp[2 * idx + 1] = _mm_unpackhi_epi8(val[idx], val[idx + 8]);
+                }
+                for (std::size_t idx = 0; idx < 16; idx++)
+                {
+                    val[idx] = tmp[idx];
+                }
+            }
+
+            for (std::size_t idx = 0; idx < 16; idx++)
+            {
+                res[idx] = val[idx];
+            }
+        }
+
+        /**
+         * @brief Traceback of 16 blocks at once, one block per 8-bits lane
+         *
+         * @param decisions  Per symbol, 8 states per lane byte, bit (state & 7) set when predecessor has oldest bit 0
+         * @param symbols    Symbols count
+         * @param states     Traceback start state of each lane
+         * @param count      Blocks count
+         * @param out        Decoded bits of each block
+         *
+         */
+
+        static void tracebackBatch(const __m128i (* decisions)[STATES_COUNT / 8], const std::size_t symbols, __m128i states, const std::size_t count, uint8_t * const * out)
+        {
+            const __m128i one     = _mm_set1_epi8(1);
+            const __m128i two     = _mm_set1_epi8(2);
+            const __m128i four    = _mm_set1_epi8(4);
+            const __m128i eight   = _mm_set1_epi8(8);
+            const __m128i lastBit = _mm_set1_epi8(STATES_COUNT - 1);
+
+            alignas(16) uint8_t bits[MAX_SYMBOLS][BATCH_LANES];                 // decoded bits, one row per symbol
+
+            for (std::size_t sym = symbols; sym > 0; sym--)
+            {
+                _mm_store_si128((__m128i *)bits[sym - 1], _mm_and_si128(_mm_srli_epi16(states, K - 2), one));
+
+                // decisions byte of the state, then bit (state & 7) of this byte
+                const __m128i low = _mm_cmpgt_epi8(eight, states);
+                const __m128i val = _mm_or_si128(_mm_and_si128(low, decisions[sym - 1][0]), _mm_andnot_si128(low, decisions[sym - 1][1]));
+
+                __m128i mask = one;
+                __m128i sel  = _mm_cmpeq_epi8(_mm_and_si128(states, one), one);
+                mask = _mm_or_si128(_mm_andnot_si128(sel, mask), _mm_and_si128(sel, _mm_add_epi8(mask, mask)));
+                sel  = _mm_cmpeq_epi8(_mm_and_si128(states, two), two);
+                mask = _mm_or_si128(_mm_andnot_si128(sel, mask), _mm_and_si128(sel, _mm_slli_epi16(mask, 2)));
+                sel  = _mm_cmpeq_epi8(_mm_and_si128(states, four), four);
+                mask = _mm_or_si128(_mm_andnot_si128(sel, mask), _mm_and_si128(sel, _mm_slli_epi16(mask, 4)));
+
+                const __m128i even = _mm_cmpeq_epi8(_mm_and_si128(val, mask), mask);
+
+                states = _mm_or_si128(_mm_and_si128(_mm_add_epi8(states, states), lastBit), _mm_andnot_si128(even, one));
+            }
+
+            // back to one row per lane, 16 symbols at once
+            for (std::size_t sym = 0; sym < symbols; sym += 16)
+            {
+                const std::size_t len = (symbols - sym < 16) ? symbols - sym : 16;
+
+                const uint8_t * rows[16];
+                for (std::size_t idx = 0; idx < 16; idx++)
+                {
+                    rows[idx] = bits[sym + (idx < len ? idx : 0)];
+                }
+
+                alignas(16) uint8_t lanes[BATCH_LANES][16];
+                loadTransposed(rows, 0, 16, 0, (__m128i *)lanes);
+
+                for (std::size_t lane = 0; lane < count; lane++)
+                {
+                    memcpy(out[lane] + sym, lanes[lane], len);
+                }
+            }
+        }
+#endif
+
+        /**
+         * @brief Traceback from the first state with best metric
+         *
+         */
+
+        static void traceback(const uint32_t * metrics, const DecisionWord * decisions, const std::size_t symbols, uint8_t * out)
+        {
+            uint32_t state = 0;
+            for (uint32_t idx = 1; idx < STATES_COUNT; idx++)
+            {
+                if (metrics[idx] < metrics[state])
+                {
+                    state = idx;
+                }
+            }
+
+            for (std::size_t sym = symbols; sym > 0; sym--)
+            {
+                out[sym - 1] = (uint8_t)(state >> (K - 2));
+                state = ((state << 1) & (STATES_COUNT - 1)) | ((decisions[sym - 1] >> state) & 0x01);
+            }
+        }
+
+        static constexpr uint32_t reverseBits(const uint32_t val, const unsigned len)
+        {
+            return len == 0 ? 0 : (((val & 0x01) << (len - 1)) | reverseBits(val >> 1, len - 1));
+        }
+
+        static uint32_t parity(const uint32_t val)
+        {
+            return (uint32_t)__builtin_popcount(val) & 0x01;
+        }
+    };
+
+    /**
+     * @brief RCPC 16-state mother code of rate 1/4 - 8.2.3.1.1
+     *
+     * G1 = 1 + D +             D^4 (8.3)
+     * G2 = 1 +     D^2 + D^3 + D^4 (8.4)
+     * G3 = 1 + D + D^2 +       D^4 (8.5)
+     * G4 = 1 + D +       D^3 + D^4 (8.6)
+     *
+     */
+
+    typedef Rate14ViterbiCodec<5, 0b10011, 0b11101, 0b10111, 0b11011> ViterbiCodec1614;
+
+};
+
+/** @} */
+
+#endif /* VITERBICODEC_H */
@@ -1,12 +1,25 @@
+#include <cerrno>
+#include <climits>
 #include <cstdio>
+#include <cstdlib>
 #include "decoder.h"
+#include "input/udpinput.h"
+#include "input/fileinput.h"
+#include "common/alloccount.h"
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <getopt.h>
 #include <netdb.h>
 
+#include <pthread.h>
+#include <sched.h>
+
 #include <string>
+#include <vector>
+#include <thread>
 #include <iostream>
+#include <chrono>
 
 #include <zmq.hpp>
 
@@ -15,6 +28,7 @@
 enum ProgramMode {
     STANDARD_MODE         = 0,
     RX_PACKED             = 4,
+    RX_SOFT               = 8,
 };
 
 /** @brief Interrupt flag */
@@ -31,12 +45,197 @@ static void sigint_handler(int val)
     gSigintFlag = 1;
 }
 
+/**
+ * @brief Carrier decoding context, one per input port
+ *
+ */
+
+struct Carrier {
+    int id;                                                                     ///< Carrier identifier reported in JSON (-1 if single carrier)
+    int port;                                                                   ///< UDP RX port
+    int cpu;                                                                    ///< CPU to pin the thread to (-1 for no pinning)
+    int programMode;                                                            ///< Input data format
+    zmq::socket_t * zmqSocket;                                                  ///< Carrier own ZMQ socket (not thread-safe)
+    Tetra::UdpInput * udpInput;                                                 ///< UDP input
+    Tetra::TetraDecoder * decoder;                                              ///< Carrier decoder
+};
+
+/**
+ * @brief Print command line help
+ *
+ */
+
+static void printUsage()
+{
+    printf("\nUsage: ./decoder [OPTIONS]\n\n"
+           "Options:\n"
+           "  -r <UDP socket> receiving from phy [default port is 42000]\n"
+           "     comma separated list to decode several carriers in one process, eg. 42000,42001\n"
+           "  -c <CPU list> pin carrier threads to CPUs, comma separated [default no pinning]\n"
+           "  -b <bytes> UDP socket receive buffer size, 0 for system default [default is 4194304]\n"
+           "  -p <count> FEC worker threads per carrier, decoding is pipelined in 3 stages sync -> FEC -> upper layers\n"
+           "     bursts are dropped when pipeline is full on UDP input [default 0, no pipeline]\n"
+           "  -m <count> consecutive bursts without training sequence before synchronization is lost [default 50]\n"
+           "  -i <file> read bits from file instead of UDP socket, - for stdin\n"
+           "  -a ZMQ url for output Json data [default is tcp://localhost:42100]\n"
+           "  -d <level> print debug information\n"
+           "  -f keep fill bits\n"
+           "  -w enable wireshark output [EXPERIMENTAL]\n"
+           "  -P pack rx data (1 byte = 8 bits)\n"
+           "  -S soft rx data (1 signed byte per bit, > 0 is 1, < 0 is 0, 0 is erasure)\n"
+           "  --timeslots <list> only decode BKN blocks of these time slots (1 to 4), comma separated, eg. 1\n"
+           "     BSCH and AACH are always decoded [default 1,2,3,4]\n"
+           "  --no-traffic don't send traffic channel (TCH) to User plane\n"
+           "  --all-slots also decode slots marked as unallocated or reserved by AACH [default skipped]\n"
+           "  -h print this help\n\n");
+}
+
+/**
+ * @brief Parse a decimal integer option value, print usage and exit when it is
+ *        not a number from minVal to maxVal
+ *
+ */
+
+static int parseNumber(const char * option, const char * txt, const int minVal, const int maxVal)
+{
+    char * end = NULL;
+    errno = 0;
+    const long val = strtol(txt, &end, 10);
+
+    if ((end == txt) || (*end != '\0') || (errno != 0) || (val < minVal) || (val > maxVal))
+    {
+        if (maxVal == INT_MAX)
+        {
+            printf("invalid value '%s' for %s, must be %d or more\n", txt, option, minVal);
+        }
+        else
+        {
+            printf("invalid value '%s' for %s, must be %d to %d\n", txt, option, minVal, maxVal);
+        }
+        printUsage();
+        exit(EXIT_FAILURE);
+    }
+
+    return (int)val;
+}
+
+/**
+ * @brief Parse comma separated integers list, each one from minVal to maxVal
+ *
+ */
+
+static std::vector<int> parseList(const char * option, const char * txt, const int minVal, const int maxVal)
+{
+    std::vector<int> res;
+    std::string str(txt);
+    std::size_t start = 0;
+
+    while (start <= str.size())
+    {
+        std::size_t end = str.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = str.size();
+        }
+
+        if (end > start)
+        {
+            res.push_back(parseNumber(option, str.substr(start, end - start).c_str(), minVal, maxVal));
+        }
+        start = end + 1;
+    }
+
+    return res;
+}
+
+/**
+ * @brief Print bursts count with skipped channel decoding
+ *
+ */
+
+static void printDecodeSkipCounters(Tetra::TetraDecoder * decoder)
+{
+    Tetra::DecodeSkipCounters counters = decoder->getDecodeSkipCounters();
+
+    printf("Skipped FEC: %llu unallocated, %llu reserved, %llu excluded time slot, %llu excluded traffic bursts\n",
+           (unsigned long long)counters.unallocated,
+           (unsigned long long)counters.reserved,
+           (unsigned long long)counters.timeslot,
+           (unsigned long long)counters.traffic);
+}
+
+/**
+ * @brief Print broadcast blocks decoding cache statistics, shared by all carriers
+ *
+ */
+
+static void printBroadcastCacheStats()
+{
+    Tetra::BroadcastCache::Stats stats = Tetra::BroadcastCache::getStats();
+
+    printf("Broadcast blocks cache: %llu hits, %llu misses\n",
+           (unsigned long long)stats.hits,
+           (unsigned long long)stats.misses);
+}
+
+/**
+ * @brief Receive and decode UDP datagrams of one carrier until interruption
+ *
+ */
+
+static void runCarrier(Carrier * carrier)
+{
+    if (carrier->cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(carrier->cpu, &cpuSet);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0)
+        {
+            fprintf(stderr, "Couldn't pin carrier on port %d to CPU %d\n", carrier->port, carrier->cpu);
+        }
+    }
+
+    while (!gSigintFlag)
+    {
+        int count = carrier->udpInput->receive();
+
+        if ((count < 0) && (errno == EINTR))
+        {
+            // print is required for ^C to be handled
+            fprintf(stderr, "EINTR\n");
+            break;
+        }
+        else if (count < 0)
+        {
+            fprintf(stderr, "Read error\n");
+            break;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            if (carrier->programMode & RX_SOFT)
+            {
+                carrier->decoder->rxSoftSymbols((const int8_t *)carrier->udpInput->data(idx), carrier->udpInput->length(idx));
+            }
+            else
+            {
+                carrier->decoder->rxSymbols(carrier->udpInput->data(idx), carrier->udpInput->length(idx), carrier->programMode & RX_PACKED);
+            }
+        }
+    }
+}
+
 /**
  * @brief Decoder program entry point
  *
  * Reads demodulated values from UDP port 42000 coming from physical demodulator
  * Writes decoded frames to UDP port 42100 to tetra interpreter
  *
+ * Several carriers can be decoded by one process, one UDP port and one thread per carrier,
+ * eg. -r 42000,42001,42002
+ *
  * Filtering log for SDS: sed -n '/SDS/ p' log.txt > out.txt
  *
  */
@@ -45,10 +244,15 @@ int main(int argc, char * argv[])
 {
     // connect interrupt Ctrl-C handler
     struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
     sa.sa_handler = sigint_handler;
     sigaction(SIGINT, &sa, 0);
 
-    int udpPortRx = 42000;                                                      // UDP RX port (ie. where to receive bits from PHY layer)
+    std::vector<int> udpPortsRx(1, 42000);                                      // UDP RX ports (ie. where to receive bits from PHY layer), one per carrier
+    std::vector<int> cpus;                                                      // CPUs to pin carrier threads to
+    int udpRcvBufSize = 4 * 1024 * 1024;                                        // UDP socket receive buffer size (absorbs bursts of load)
+    int fecWorkers = 0;                                                         // FEC worker threads per carrier, 0 for synchronous decoding
+    int maxSyncMisses = 50;                                                     // consecutive missed bursts before synchronization is lost
 
     int programMode = STANDARD_MODE;
     int debugLevel = 1;
@@ -56,22 +260,84 @@ int main(int argc, char * argv[])
     bool bEnableWiresharkOutput = false;
 
     char queueUrl[255] = "tcp://localhost:42100";     // initialize the zmq context with a single IO thread
+    char inputFile[255] = "";                                                   // offline input file, "-" for stdin, UDP socket when empty
+
+    Tetra::DecodePolicy decodePolicy;                                           // skip FEC of slots we don't care about
+    decodePolicy.timeslots = 0x0F;
+    decodePolicy.bTraffic  = true;
+    decodePolicy.bSkipIdle = true;
+
+    enum LongOption {
+        OPT_TIMESLOTS = 256,
+        OPT_NO_TRAFFIC,
+        OPT_ALL_SLOTS
+    };
+
+    static const struct option longOptions[] = {
+        {"timeslots",  required_argument, NULL, OPT_TIMESLOTS},
+        {"no-traffic", no_argument,       NULL, OPT_NO_TRAFFIC},
+        {"all-slots",  no_argument,       NULL, OPT_ALL_SLOTS},
+        {NULL,         0,                 NULL, 0}
+    };
 
     int option;
-    while ((option = getopt(argc, argv, "hPwr:a:d:f")) != -1)
+    while ((option = getopt_long(argc, argv, "hPSwr:b:c:p:m:i:a:d:f", longOptions, NULL)) != -1)
     {
         switch (option)
         {
+        case OPT_TIMESLOTS:
+        {
+            std::vector<int> timeslots = parseList("--timeslots", optarg, 1, 4);
+            decodePolicy.timeslots = 0;
+            for (std::size_t idx = 0; idx < timeslots.size(); idx++)
+            {
+                decodePolicy.timeslots |= (uint8_t)(1 << (timeslots[idx] - 1));
+            }
+            break;
+        }
+
+        case OPT_NO_TRAFFIC:
+            decodePolicy.bTraffic = false;
+            break;
+
+        case OPT_ALL_SLOTS:
+            decodePolicy.bSkipIdle = false;
+            break;
+
         case 'r':
-            udpPortRx = atoi(optarg);
+            udpPortsRx = parseList("-r", optarg, 1, 65535);
+            break;
+
+        case 'c':
+            cpus = parseList("-c", optarg, 0, INT_MAX);
+            break;
+
+        case 'b':
+            udpRcvBufSize = parseNumber("-b", optarg, 0, INT_MAX);
+            break;
+
+        case 'p':
+            fecWorkers = parseNumber("-p", optarg, 0, INT_MAX);
+            break;
+
+        case 'm':
+            maxSyncMisses = parseNumber("-m", optarg, 1, INT_MAX);
+            break;
+
+        case 'i':
+            strncpy(inputFile, optarg, sizeof(inputFile) - 1);
             break;
 
         case 'P':
             programMode |= RX_PACKED;
             break;
 
+        case 'S':
+            programMode |= RX_SOFT;
+            break;
+
         case 'd':
-            debugLevel = atoi(optarg);
+            debugLevel = parseNumber("-d", optarg, 0, INT_MAX);
             break;
 
         case 'f':
@@ -88,15 +354,7 @@ int main(int argc, char * argv[])
             break;
 
         case 'h':
-            printf("\nUsage: ./decoder [OPTIONS]\n\n"
-                   "Options:\n"
-                   "  -r <UDP socket> receiving from phy [default port is 42000]\n"
-                   "  -a ZMQ url for output Json data [default is tcp://localhost:42100]\n"
-                   "  -d <level> print debug information\n"
-                   "  -f keep fill bits\n"
-                   "  -w enable wireshark output [EXPERIMENTAL]\n"
-                   "  -P pack rx data (1 byte = 8 bits)\n"
-                   "  -h print this help\n\n");
+            printUsage();
             exit(EXIT_FAILURE);
             break;
 
@@ -108,14 +366,22 @@ int main(int argc, char * argv[])
     }
 
     
+    if (udpPortsRx.empty())
+    {
+        printf("no UDP port given\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if ((programMode & RX_PACKED) && (programMode & RX_SOFT))
+    {
+        printf("packed and soft rx data are exclusive\n");
+        exit(EXIT_FAILURE);
+    }
+
     printf("Destination: %s\n", queueUrl);
 
     zmq::context_t zmqContext{1};
 
-    // construct a REQ (request) socket and connect to interface
-    zmq::socket_t zmqSocket{zmqContext, zmq::socket_type::push};
-    zmqSocket.connect(queueUrl);
-
     // create decoder
     Tetra::LogLevel logLevel;
     switch (debugLevel)
@@ -140,79 +406,176 @@ int main(int argc, char * argv[])
 
     }
 
-    // input source
-    int fdInput = 0;
+    if (inputFile[0] != '\0')
+    {
+        // construct a PUSH socket and connect to interface
+        zmq::socket_t zmqSocket{zmqContext, zmq::socket_type::push};
+        zmqSocket.connect(queueUrl);
 
-    // read input bits from UDP socket
-    struct sockaddr_in addr;
-    memset(&addr, 0, sizeof(struct sockaddr_in));
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(udpPortRx);
-    inet_aton("0.0.0.0", &addr.sin_addr);
+        // create decoder
+        Tetra::TetraDecoder * decoder = new Tetra::TetraDecoder(&zmqSocket, bRemoveFillBits, logLevel, bEnableWiresharkOutput, -1, fecWorkers, true);
+        decoder->setMaxSyncMisses((uint32_t)maxSyncMisses);
+        decoder->setDecodePolicy(decodePolicy);
 
-    fdInput = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-    bind(fdInput, (struct sockaddr *)&addr, sizeof(struct sockaddr));
+        // read input bits from file or stdin as fast as possible
+        Tetra::FileInput * fileInput = new Tetra::FileInput(inputFile);
 
-    printf("Input socket 0x%04x on port %d\n", fdInput, udpPortRx);
+        if (!fileInput->isOpen())
+        {
+            fprintf(stderr, "Couldn't open input file %s\n", inputFile);
+            exit(EXIT_FAILURE);
+        }
 
-    if (fdInput < 0)
-    {
-        fprintf(stderr, "Couldn't create input socket");
-        exit(EXIT_FAILURE);
-    }
+        printf("Input file %s%s\n", inputFile, fileInput->isMapped() ? " (mapped)" : "");
 
-    // create decoder
-    Tetra::TetraDecoder * decoder = new Tetra::TetraDecoder(&zmqSocket, bRemoveFillBits, logLevel, bEnableWiresharkOutput);
+        uint64_t bitsCount = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
-    // receive buffer
-    const int RXBUF_LEN = 1024;
-    uint8_t rxBuf[RXBUF_LEN];
+        while (!gSigintFlag)
+        {
+            const uint8_t * data;
+            ssize_t len = fileInput->read(&data);
+
+            if ((len < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+            else if (len < 0)
+            {
+                fprintf(stderr, "Read error\n");
+                break;
+            }
+            else if (len == 0)
+            {
+                break;
+            }
+
+            if (programMode & RX_SOFT)
+            {
+                decoder->rxSoftSymbols((const int8_t *)data, (std::size_t)len);
+            }
+            else
+            {
+                decoder->rxSymbols(data, (std::size_t)len, programMode & RX_PACKED);
+            }
+            bitsCount += (programMode & RX_PACKED) ? 8 * (uint64_t)len : (uint64_t)len;
+        }
 
-    while (!gSigintFlag)
+        decoder->flushPipeline();                                               // wait for bursts still in pipeline
+
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed <= 0.0)
+        {
+            elapsed = 1e-9;
+        }
+
+        uint64_t burstsCount = decoder->getBurstsCount();
+        printf("Processed %llu bits, %llu bursts in %.3f s: %.0f bits/s, %.0f bursts/s (x%.1f real time)\n",
+               (unsigned long long)bitsCount,
+               (unsigned long long)burstsCount,
+               elapsed,
+               (double)bitsCount / elapsed,
+               (double)burstsCount / elapsed,
+               (double)bitsCount / elapsed / 36000.0);                          // 36 kbit/s air interface gross bit rate
+        printDecodeSkipCounters(decoder);
+        printBroadcastCacheStats();
+
+#ifdef DEBUG_ALLOC_COUNT
+        printf("Channel decoding: %llu heap allocations in %llu decoding passes\n",
+               (unsigned long long)Tetra::AllocCount::decodingPassesAllocations(),
+               (unsigned long long)Tetra::AllocCount::decodingPasses());
+#endif
+
+        delete fileInput;
+        delete decoder;
+
+        zmqSocket.close();
+    }
+    else
     {
-        int bytesRead = read(fdInput, rxBuf, sizeof(rxBuf));
+        // one decoder per carrier, each carrier has its own UDP input, ZMQ socket and thread
+        // read-only tables (Viterbi codec...) are shared between decoders
+        const bool bMultiCarrier = udpPortsRx.size() > 1;
+        std::vector<Carrier> carriers(udpPortsRx.size());
 
-        if (errno == EINTR)
+        for (std::size_t idx = 0; idx < carriers.size(); idx++)
         {
-            // print is required for ^C to be handled
-            fprintf(stderr, "EINTR\n");
-            break;
+            Carrier * carrier = &carriers[idx];
+
+            carrier->id          = bMultiCarrier ? (int)idx : -1;
+            carrier->port        = udpPortsRx[idx];
+            carrier->cpu         = cpus.empty() ? -1 : cpus[idx % cpus.size()];
+            carrier->programMode = programMode;
+
+            carrier->zmqSocket = new zmq::socket_t(zmqContext, zmq::socket_type::push);
+            carrier->zmqSocket->connect(queueUrl);
+
+            carrier->decoder  = new Tetra::TetraDecoder(carrier->zmqSocket, bRemoveFillBits, logLevel, bEnableWiresharkOutput, carrier->id, fecWorkers, false);
+            carrier->decoder->setMaxSyncMisses((uint32_t)maxSyncMisses);
+            carrier->decoder->setDecodePolicy(decodePolicy);
+
+            // read input bits from UDP socket
+            carrier->udpInput = new Tetra::UdpInput(carrier->port, udpRcvBufSize);
+
+            if (!carrier->udpInput->isOpen())
+            {
+                fprintf(stderr, "Couldn't create input socket on port %d\n", carrier->port);
+                exit(EXIT_FAILURE);
+            }
+
+            carrier->udpInput->setReceiveTimeout(200);                          // threads not receiving SIGINT must check the interrupt flag
+
+            printf("Input socket on port %d, receive buffer %d bytes%s\n", carrier->port, carrier->udpInput->getReceiveBufferSize(),
+                   bMultiCarrier ? Tetra::formatStr(", carrier %d", carrier->id).c_str() : "");
         }
-        else if (bytesRead < 0)
+
+        if (bMultiCarrier)
         {
-            fprintf(stderr, "Read error\n");
-            break;
+            std::vector<std::thread> threads;
+
+            for (std::size_t idx = 0; idx < carriers.size(); idx++)
+            {
+                threads.push_back(std::thread(runCarrier, &carriers[idx]));
+            }
+
+            for (std::size_t idx = 0; idx < threads.size(); idx++)
+            {
+                threads[idx].join();
+            }
         }
-        else if (bytesRead == 0)
+        else
         {
-            break;
+            runCarrier(&carriers[0]);
         }
 
-        // bytes must be pushed one at a time into decoder
-        for (int cnt = 0; cnt < bytesRead; cnt++)
+        for (std::size_t idx = 0; idx < carriers.size(); idx++)
         {
-        	if (programMode & RX_PACKED)
-        	{
-        		for (uint8_t idx = 0; idx <= 7; idx++)
-        	    {
-        			decoder->rxSymbol((rxBuf[cnt] >> idx) & 0x01);
-        		}
-        	}
-        	else
-        	{
-        		decoder->rxSymbol(rxBuf[cnt]);
-        	}
+            if (bMultiCarrier)
+            {
+                printf("Carrier %d port %d - ", carriers[idx].id, carriers[idx].port);
+            }
+            carriers[idx].udpInput->printStats(stdout);
+
+            carriers[idx].decoder->flushPipeline();
+            if (fecWorkers > 0)
+            {
+                printf("Pipeline: %llu bursts dropped\n", (unsigned long long)carriers[idx].decoder->getDroppedBurstsCount());
+            }
+            printDecodeSkipCounters(carriers[idx].decoder);
+
+            // socket must be closed
+            delete carriers[idx].udpInput;
+            delete carriers[idx].decoder;
+
+            carriers[idx].zmqSocket->close();
+            delete carriers[idx].zmqSocket;
         }
+
+        printBroadcastCacheStats();
     }
 
-    // file or socket must be closed
-    close(fdInput);
-    
-    zmqSocket.close();
     zmqContext.close();
 
-    delete decoder;
-
     printf("Clean exit\n");
 
     return EXIT_SUCCESS;
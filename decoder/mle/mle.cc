@@ -30,11 +30,11 @@ Mle::~Mle()
  *
  */
 
-void Mle::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Mle::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mle", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mle", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
 
     std::string txt   = "";
     std::string infos = "";
@@ -103,7 +103,7 @@ void Mle::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
 
     if (bPrintInfos)
     {
-        m_log->print(LogLevel::LOW, "service_mle : TN/FN/MN = %2u/%2u/%2u  %-20s  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), infos.c_str());
+        LOG_PRINT(m_log, LogLevel::LOW, "service_mle : TN/FN/MN = %2u/%2u/%2u  %-20s  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), infos.c_str());
     }
 }
 
@@ -112,9 +112,9 @@ void Mle::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime
  *
  */
 
-void Mle::serviceMleSubsystem(Pdu pdu, MacLogicalChannel macLogicalChannel)
+void Mle::serviceMleSubsystem(const Pdu & pdu, MacLogicalChannel macLogicalChannel)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mle_subsystem", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mle_subsystem", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
 
     std::string txt = "";
 
@@ -161,7 +161,7 @@ void Mle::serviceMleSubsystem(Pdu pdu, MacLogicalChannel macLogicalChannel)
         break;
     }
 
-    m_log->print(LogLevel::LOW, "serv_mle_sub: TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
+    LOG_PRINT(m_log, LogLevel::LOW, "serv_mle_sub: TN/FN/MN = %2u/%2u/%2u  %-20s\n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str());
 }
 
 /**
@@ -169,9 +169,9 @@ void Mle::serviceMleSubsystem(Pdu pdu, MacLogicalChannel macLogicalChannel)
  *
  */
 
-void Mle::processDNwrkBroadcast(Pdu pdu)
+void Mle::processDNwrkBroadcast(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_process_d_nwrk_broadcast", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_process_d_nwrk_broadcast", pdu.toString().c_str());
 
     m_report->start("MLE", "D-NWRK-BROADCAST", m_tetraTime, m_macAddress);
 
@@ -223,9 +223,9 @@ void Mle::processDNwrkBroadcast(Pdu pdu)
  *
  */
 
-void Mle::processDNwrkBroadcastExtension(Pdu pdu)
+void Mle::processDNwrkBroadcastExtension(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_process_d_nwrk_broadcast_extension", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_process_d_nwrk_broadcast_extension", pdu.toString().c_str());
 
     m_report->start("MLE", "D-NWRK-BROADCAST-EXTENSION", m_tetraTime, m_macAddress);
 
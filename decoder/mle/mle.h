@@ -17,25 +17,25 @@ namespace Tetra {
         Mle(Log * log, Report * report, Layer * cmce, Layer * mm, Layer * sndcp);
         ~Mle();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
         Layer * m_cmce;
         Layer * m_mm;
         Layer * m_sndcp;
 
-        void serviceMleSubsystem(Pdu pdu, MacLogicalChannel macLogicalChannel);
-        void processDNwrkBroadcast(Pdu pdu);
-        void processDNwrkBroadcastExtension(Pdu pdu);
-
-        uint64_t parseBsServiceDetails(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
-        uint64_t parseCellReselectParameters(Pdu pdu, uint64_t pos);
-        uint64_t parseMainCarrierNumberExtension(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
-        uint64_t parseNeighbourCellBroadcast(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
-        uint32_t parseNeighbourCellInformation(Pdu data, uint32_t posStart, std::vector<std::tuple<std::string, uint64_t>> & infos);
-        uint64_t parseTetraNetworkTime(Pdu pdu, uint64_t pos);
-        uint64_t parseTimeshareOrSecurity(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements);
-        uint64_t parseSecurityParameters(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements);
+        void serviceMleSubsystem(const Pdu & pdu, MacLogicalChannel macLogicalChannel);
+        void processDNwrkBroadcast(const Pdu & pdu);
+        void processDNwrkBroadcastExtension(const Pdu & pdu);
+
+        uint64_t parseBsServiceDetails(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
+        uint64_t parseCellReselectParameters(const Pdu & pdu, uint64_t pos);
+        uint64_t parseMainCarrierNumberExtension(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
+        uint64_t parseNeighbourCellBroadcast(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos);
+        uint32_t parseNeighbourCellInformation(const Pdu & data, uint32_t posStart, std::vector<std::tuple<std::string, uint64_t>> & infos);
+        uint64_t parseTetraNetworkTime(const Pdu & pdu, uint64_t pos);
+        uint64_t parseTimeshareOrSecurity(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements);
+        uint64_t parseSecurityParameters(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements);
     };
 
 };
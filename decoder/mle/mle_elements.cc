@@ -7,9 +7,9 @@ using namespace Tetra;
  *
 */
 
-uint64_t Mle::parseBsServiceDetails(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
+uint64_t Mle::parseBsServiceDetails(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_bs_service_details", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_bs_service_details", pdu.toString().c_str());
 
     infos.push_back(std::make_tuple("Registration mandatory", pdu.getValue(pos, 1)));
     pos += 1;
@@ -44,9 +44,9 @@ uint64_t Mle::parseBsServiceDetails(Pdu pdu, uint64_t pos, std::vector<std::tupl
  *
  */
 
-uint64_t Mle::parseCellReselectParameters(Pdu pdu, uint64_t pos)
+uint64_t Mle::parseCellReselectParameters(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_cell_reselect_parameters", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_cell_reselect_parameters", pdu.toString().c_str());
 
     uint8_t thresholdDb = pdu.getValue(pos, 4) * 2;
     m_report->add("SLOW_RESELECT_THRESHOLD_ABOVE_FAST", thresholdDb);
@@ -72,9 +72,9 @@ uint64_t Mle::parseCellReselectParameters(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mle::parseMainCarrierNumberExtension(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
+uint64_t Mle::parseMainCarrierNumberExtension(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_main_carrier_number_extension", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_main_carrier_number_extension", pdu.toString().c_str());
 
     uint64_t freqBand = pdu.getValue(pos, 4) * 100;
     infos.push_back(std::make_tuple("Frequency band", freqBand));
@@ -92,9 +92,9 @@ uint64_t Mle::parseMainCarrierNumberExtension(Pdu pdu, uint64_t pos, std::vector
     return pos;
 }
 
-uint64_t Mle::parseNeighbourCellBroadcast(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
+uint64_t Mle::parseNeighbourCellBroadcast(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & infos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_neighbour_cell_broadcast", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_neighbour_cell_broadcast", pdu.toString().c_str());
 
     infos.push_back(std::make_tuple("D-NWRK-BROADCAST broadcast supported", pdu.getValue(pos, 1)));
     pos += 1;
@@ -111,7 +111,7 @@ uint64_t Mle::parseNeighbourCellBroadcast(Pdu pdu, uint64_t pos, std::vector<std
  *
  */
 
-uint32_t Mle::parseNeighbourCellInformation(Pdu data, uint32_t posStart, std::vector<std::tuple<std::string, uint64_t>> & infos)
+uint32_t Mle::parseNeighbourCellInformation(const Pdu & data, uint32_t posStart, std::vector<std::tuple<std::string, uint64_t>> & infos)
 {
     uint32_t pos = posStart;
 
@@ -224,9 +224,9 @@ uint32_t Mle::parseNeighbourCellInformation(Pdu data, uint32_t posStart, std::ve
  *
 */
 
-uint64_t Mle::parseTetraNetworkTime(Pdu pdu, uint64_t pos)
+uint64_t Mle::parseTetraNetworkTime(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_tetra_network_time", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_tetra_network_time", pdu.toString().c_str());
 
     uint32_t utctime = pdu.getValue(pos, 24) * 2;
     pos += 24;
@@ -247,12 +247,12 @@ uint64_t Mle::parseTetraNetworkTime(Pdu pdu, uint64_t pos)
         int offsetsec = looffset * (sign ? -15 : 15) * 60;              // calc offset in seconds
 
         time_t rawtime =  utctime + offsetsec;                          // 1.1.1970 00:00:00
-        struct tm * timeinfo;
-        timeinfo = localtime(&rawtime);
-        timeinfo->tm_year += (30 + year);                               // Tetra time starts at year 2000
+        struct tm timeinfo;
+        localtime_r(&rawtime, &timeinfo);                               // reentrant version, decoders may run in several threads
+        timeinfo.tm_year += (30 + year);                                // Tetra time starts at year 2000
 
         char buf[sizeof("2000-01-01T00:00:00Z")];
-        strftime(buf, sizeof(buf), "%FT%TZ", timeinfo);                 // encode time as ISO 8601 string
+        strftime(buf, sizeof(buf), "%FT%TZ", &timeinfo);                // encode time as ISO 8601 string
         m_report->add("TETRA network time", buf);
     }
 
@@ -264,9 +264,9 @@ uint64_t Mle::parseTetraNetworkTime(Pdu pdu, uint64_t pos)
  *
 */
 
-uint64_t Mle::parseTimeshareOrSecurity(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements)
+uint64_t Mle::parseTimeshareOrSecurity(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_timeshare_or_security", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_timeshare_or_security", pdu.toString().c_str());
 
     uint8_t discMode = pdu.getValue(pos, 2);
     elements.push_back(std::make_tuple("Discontinuous mode", pdu.getValue(pos, 2)));
@@ -290,9 +290,9 @@ uint64_t Mle::parseTimeshareOrSecurity(Pdu pdu, uint64_t pos, std::vector<std::t
  *
 */
 
-uint64_t Mle::parseSecurityParameters(Pdu pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements)
+uint64_t Mle::parseSecurityParameters(const Pdu & pdu, uint64_t pos, std::vector<std::tuple<std::string, uint64_t>> & elements)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_security_parameters", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mle_parse_security_parameters", pdu.toString().c_str());
 
     elements.push_back(std::make_tuple("Authentication required", pdu.getValue(pos, 1)));
     pos += 1;
@@ -7,9 +7,9 @@ using namespace Tetra;
  *
  */
 
-void Mm::parseDAuthentication(Pdu pdu)
+void Mm::parseDAuthentication(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication", pdu.toString().c_str());
 
     uint32_t pos = 0;
     uint8_t authenticationSubType = pdu.getValue(pos, 2);
@@ -45,9 +45,9 @@ void Mm::parseDAuthentication(Pdu pdu)
  *
  */
 
-void Mm::parseDAuthenticationDemand(Pdu pdu)
+void Mm::parseDAuthenticationDemand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_demand", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_demand", pdu.toString().c_str());
 
     m_report->start("MM", "D-AUTHENTICATION DEMAND", m_tetraTime, m_macAddress);
 
@@ -67,9 +67,9 @@ void Mm::parseDAuthenticationDemand(Pdu pdu)
  *
  */
 
-void Mm::parseDAuthenticationResponse(Pdu pdu)
+void Mm::parseDAuthenticationResponse(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_response", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_response", pdu.toString().c_str());
 
     m_report->start("MM", "D-AUTHENTICATION RESPONSE", m_tetraTime, m_macAddress);
 
@@ -98,9 +98,9 @@ void Mm::parseDAuthenticationResponse(Pdu pdu)
  *
  */
 
-void Mm::parseDAuthenticationResult(Pdu pdu)
+void Mm::parseDAuthenticationResult(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_result", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_result", pdu.toString().c_str());
 
     m_report->start("MM", "D-AUTHENTICATION RESULT", m_tetraTime, m_macAddress);
 
@@ -126,9 +126,9 @@ void Mm::parseDAuthenticationResult(Pdu pdu)
  *
  */
 
-void Mm::parseDAuthenticationReject(Pdu pdu)
+void Mm::parseDAuthenticationReject(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_reject", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_authentication_reject", pdu.toString().c_str());
 
     m_report->start("MM", "D-AUTHENTICATION REJECT", m_tetraTime, m_macAddress);
 
@@ -7,9 +7,9 @@ using namespace Tetra;
  *
  */
 
-void Mm::parseDMmStatus(Pdu pdu)
+void Mm::parseDMmStatus(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_mm_status", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_mm_status", pdu.toString().c_str());
 
     uint32_t pos = 4;                                                           // pdu type
 
@@ -48,9 +48,9 @@ void Mm::parseDMmStatus(Pdu pdu)
  *
  */
 
-void Mm::parseDChangeOfEnergySavingModeRequest(Pdu pdu)
+void Mm::parseDChangeOfEnergySavingModeRequest(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_esm_request", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_esm_request", pdu.toString().c_str());
 
     m_report->start("MM", "D-CHANGE OF ENERGY SAVING MODE REQUEST", m_tetraTime, m_macAddress);
 
@@ -67,9 +67,9 @@ void Mm::parseDChangeOfEnergySavingModeRequest(Pdu pdu)
  *
  */
 
-void Mm::parseDChangeOfEnergySavingModeResponse(Pdu pdu)
+void Mm::parseDChangeOfEnergySavingModeResponse(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_esm_response", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_esm_response", pdu.toString().c_str());
 
     m_report->start("MM", "D-CHANGE OF ENERGY SAVING MODE RESPONSE", m_tetraTime, m_macAddress);
 
@@ -86,9 +86,9 @@ void Mm::parseDChangeOfEnergySavingModeResponse(Pdu pdu)
  *
  */
 
-void Mm::parseDDualWatchModeResponse(Pdu pdu)
+void Mm::parseDDualWatchModeResponse(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_dual_watch_mode_response", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_dual_watch_mode_response", pdu.toString().c_str());
 
     m_report->start("MM", "D-DUAL WATCH MODE RESPONSE", m_tetraTime, m_macAddress);
 
@@ -134,9 +134,9 @@ void Mm::parseDDualWatchModeResponse(Pdu pdu)
  *
  */
 
-void Mm::parseDTerminatingDualWatchModeResponse(Pdu pdu)
+void Mm::parseDTerminatingDualWatchModeResponse(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_terminating_dwm_response", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_terminating_dwm_response", pdu.toString().c_str());
 
     m_report->start("MM", "D-TERMINATING DUAL WATCH MODE RESPONSE", m_tetraTime, m_macAddress);
 
@@ -185,9 +185,9 @@ void Mm::parseDTerminatingDualWatchModeResponse(Pdu pdu)
  *
  */
 
-void Mm::parseDChangeOfDualWatchModeRequest(Pdu pdu)
+void Mm::parseDChangeOfDualWatchModeRequest(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_dwm_request", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_change_of_dwm_request", pdu.toString().c_str());
 
     m_report->start("MM", "D-CHANGE OF DUAL WATCH MODE REQUEST", m_tetraTime, m_macAddress);
 
@@ -246,9 +246,9 @@ void Mm::parseDChangeOfDualWatchModeRequest(Pdu pdu)
  *  No useful data to be parsed in this PDU.
  */
 
-void Mm::parseDMsFrequencyBandsRequest(Pdu pdu)
+void Mm::parseDMsFrequencyBandsRequest(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_ms_frequency_bands_request", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_ms_frequency_bands_request", pdu.toString().c_str());
 
     m_report->start("MM", "D-MS FREQUENCY BANDS REQUEST", m_tetraTime, m_macAddress);
 
@@ -276,9 +276,9 @@ void Mm::parseDMsFrequencyBandsRequest(Pdu pdu)
  *
  */
 
-void Mm::parseDDistanceReportingRequest(Pdu pdu)
+void Mm::parseDDistanceReportingRequest(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_distance_reporting_request", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_distance_reporting_request", pdu.toString().c_str());
 
     m_report->start("MM", "D-DISTANCE REPORTING REQUEST", m_tetraTime, m_macAddress);
 
@@ -7,9 +7,9 @@ using namespace Tetra;
  *
  */
 
-void Mm::parseDOtar(Pdu pdu)
+void Mm::parseDOtar(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar", pdu.toString().c_str());
 
     uint32_t pos = 4;                                                           // pdu type
     uint32_t otarSubtype = pdu.getValue(pos, 4);
@@ -84,9 +84,9 @@ void Mm::parseDOtar(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarCckProvide(Pdu pdu)
+void Mm::parseDOtarCckProvide(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_cck_provide", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_cck_provide", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR CCK Provide", m_tetraTime, m_macAddress);
 
@@ -107,9 +107,9 @@ void Mm::parseDOtarCckProvide(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarSckProvide(Pdu pdu)
+void Mm::parseDOtarSckProvide(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_sck_provide", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_sck_provide", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR SCK Provide", m_tetraTime, m_macAddress);
 
@@ -182,9 +182,9 @@ void Mm::parseDOtarSckProvide(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarSckReject(Pdu pdu)
+void Mm::parseDOtarSckReject(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_sck_reject", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_sck_reject", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR SCK Reject", m_tetraTime, m_macAddress);
 
@@ -223,9 +223,9 @@ void Mm::parseDOtarSckReject(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarGckProvide(Pdu pdu)
+void Mm::parseDOtarGckProvide(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gck_provide", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gck_provide", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR GCK Provide", m_tetraTime, m_macAddress);
 
@@ -310,9 +310,9 @@ void Mm::parseDOtarGckProvide(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarGckReject(Pdu pdu)
+void Mm::parseDOtarGckReject(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gck_reject", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gck_reject", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR GCK Reject", m_tetraTime, m_macAddress);
 
@@ -351,9 +351,9 @@ void Mm::parseDOtarGckReject(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarKeyAssociateDemand(Pdu pdu)
+void Mm::parseDOtarKeyAssociateDemand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_associate_demand", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_associate_demand", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR KEY ASSOCIATE demand", m_tetraTime, m_macAddress);
 
@@ -418,9 +418,9 @@ void Mm::parseDOtarKeyAssociateDemand(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarNewcell(Pdu pdu)
+void Mm::parseDOtarNewcell(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_newcell", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_newcell", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR NEWCELL", m_tetraTime, m_macAddress);
 
@@ -451,9 +451,9 @@ void Mm::parseDOtarNewcell(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarGskoProvide(Pdu pdu)
+void Mm::parseDOtarGskoProvide(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gsko_provide", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gsko_provide", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR GSKO Provide", m_tetraTime, m_macAddress);
 
@@ -492,9 +492,9 @@ void Mm::parseDOtarGskoProvide(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarGskoReject(Pdu pdu)
+void Mm::parseDOtarGskoReject(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gsko_reject", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_gsko_reject", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR GSKO Reject", m_tetraTime, m_macAddress);
 
@@ -530,9 +530,9 @@ void Mm::parseDOtarGskoReject(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarKeyDeleteDemand(Pdu pdu)
+void Mm::parseDOtarKeyDeleteDemand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_delete_demand", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_delete_demand", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR KEY DELETE demand", m_tetraTime, m_macAddress);
 
@@ -595,9 +595,9 @@ void Mm::parseDOtarKeyDeleteDemand(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarKeyStatusDemand(Pdu pdu)
+void Mm::parseDOtarKeyStatusDemand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_status_demand", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_key_status_demand", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR KEY STATUS demand", m_tetraTime, m_macAddress);
 
@@ -658,9 +658,9 @@ void Mm::parseDOtarKeyStatusDemand(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarCmgGtsiProvide(Pdu pdu)
+void Mm::parseDOtarCmgGtsiProvide(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_cmg_gtsi_provide", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_cmg_gtsi_provide", pdu.toString().c_str());
 
     m_report->start("MM", "D-OTAR CMG GTSI PROVIDE", m_tetraTime, m_macAddress);
 
@@ -690,9 +690,9 @@ void Mm::parseDOtarCmgGtsiProvide(Pdu pdu)
  *
  */
 
-void Mm::parseDOtarDmSckActivate(Pdu pdu)
+void Mm::parseDOtarDmSckActivate(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_dm_sck_activate", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_otar_dm_sck_activate", pdu.toString().c_str());
 
     m_report->start("MM", "D-DM-SCK ACTIVATE DEMAND", m_tetraTime, m_macAddress);
 
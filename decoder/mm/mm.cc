@@ -27,13 +27,13 @@ Mm::~Mm()
  *
  */
 
-void Mm::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Mm::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mm", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_mm", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
 
-    std::string txt = pdu.toString();
+    std::string txt;                                                            // PDU name, bits are printed when unknown
 
     uint32_t pos = 0;
     uint8_t pduType = pdu.getValue(pos, 4);
@@ -101,7 +101,7 @@ void Mm::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime t
         break;
     }
 
-    m_log->print(LogLevel::MEDIUM, "serv_mm_sub : TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu \n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.c_str(), pdu.size());
+    LOG_PRINT(m_log, LogLevel::MEDIUM, "serv_mm_sub : TN/FN/MN = %2u/%2u/%2u  %-20s  len=%3lu \n", m_tetraTime.tn, m_tetraTime.fn, m_tetraTime.mn, txt.empty() ? pdu.toString().c_str() : txt.c_str(), pdu.size());
 }
 
 
@@ -110,9 +110,9 @@ void Mm::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime t
  *
  */
 
-void Mm::parseDCkChangeDemand(Pdu pdu)
+void Mm::parseDCkChangeDemand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_ck_change_demand", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_ck_change_demand", pdu.toString().c_str());
 
     m_report->start("MM", "D-CK CHANGE DEMAND", m_tetraTime, m_macAddress);
 
@@ -216,9 +216,9 @@ void Mm::parseDCkChangeDemand(Pdu pdu)
  *
  */
 
-void Mm::parseDDisable(Pdu pdu)
+void Mm::parseDDisable(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_disable", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_disable", pdu.toString().c_str());
 
     m_report->start("MM", "D-DISABLE", m_tetraTime, m_macAddress);
 
@@ -273,9 +273,9 @@ void Mm::parseDDisable(Pdu pdu)
  *
  */
 
-void Mm::parseDEnable(Pdu pdu)
+void Mm::parseDEnable(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_enable", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_enable", pdu.toString().c_str());
 
     m_report->start("MM", "D-ENABLE", m_tetraTime, m_macAddress);
 
@@ -327,9 +327,9 @@ void Mm::parseDEnable(Pdu pdu)
  *
  */
 
-void Mm::parseDLocationUpdateAccept(Pdu pdu)
+void Mm::parseDLocationUpdateAccept(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_accept", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_accept", pdu.toString().c_str());
 
     m_report->start("MM", "D-LOCATION UPDATE ACCEPT", m_tetraTime, m_macAddress);
 
@@ -400,9 +400,9 @@ void Mm::parseDLocationUpdateAccept(Pdu pdu)
  *
  */
 
-void Mm::parseDLocationUpdateCommand(Pdu pdu)
+void Mm::parseDLocationUpdateCommand(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_command", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_command", pdu.toString().c_str());
 
     m_report->start("MM", "D-LOCATION UPDATE COMMAND", m_tetraTime, m_macAddress);
 
@@ -453,9 +453,9 @@ void Mm::parseDLocationUpdateCommand(Pdu pdu)
  *
  */
 
-void Mm::parseDLocationUpdateReject(Pdu pdu)
+void Mm::parseDLocationUpdateReject(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_reject", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_reject", pdu.toString().c_str());
 
     m_report->start("MM", "D-LOCATION UPDATE REJECT", m_tetraTime, m_macAddress);
 
@@ -512,9 +512,9 @@ void Mm::parseDLocationUpdateReject(Pdu pdu)
  *
  */
 
-void Mm::parseDLocationUpdateProceeding(Pdu pdu)
+void Mm::parseDLocationUpdateProceeding(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_proceeding", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_location_update_proceeding", pdu.toString().c_str());
 
     m_report->start("MM", "D-LOCATION UPDATE PROCEEDING", m_tetraTime, m_macAddress);
 
@@ -534,46 +534,25 @@ void Mm::parseDLocationUpdateProceeding(Pdu pdu)
  *
  */
 
-void Mm::parseDAttachDetachGroupIdentity(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_attach_detach_group_identity", pdu.toString().c_str());
-
-    m_report->start("MM", "D-ATTACH/DETACH GROUP IDENTITY", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 4;                                                           // pdu type
-
-    m_report->add("Group identity report request", boolToString(pdu.getValue(pos, 1)));
-    pos += 1;
-
-    m_report->add("Group identity acknowledgement requested", boolToString(pdu.getValue(pos, 1)));
-    pos += 1;
-
-    bool groupIdAttachMode = pdu.getValue(pos, 1);
-    pos += 1;
-
-    if (groupIdAttachMode)
-    {
-        m_report->add("Group identity attach/detach mode", "Detach all and attach");
-    }
-    else
-    {
-        m_report->add("Group identity attach/detach mode", "Amendment");
-    }
+static constexpr const char * BOOL_NAMES[] = {"false", "true"};
+static constexpr const char * BOOL_NOT_NAMES[] = {"true", "false"};
+static constexpr const char * GROUP_ID_ATTACH_MODE_NAMES[] = {"Amendment", "Detach all and attach"};
 
-    bool oBit = pdu.getValue(pos, 1);                                           // o-bit
-    pos += 1;
+static constexpr PduField D_ATTACH_DETACH_GROUP_IDENTITY_FIELDS[] = {
+    fieldEnum("Group identity report request", 1, BOOL_NAMES),
+    fieldEnum("Group identity acknowledgement requested", 1, BOOL_NAMES),
+    fieldEnum("Group identity attach/detach mode", 1, GROUP_ID_ATTACH_MODE_NAMES),
+    fieldObit(),                                                                // there are type 2/3/4 elements
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    if (oBit)                                                                   // there are type 2/3/4 elements
-    {
-        bool mBit = pdu.getValue(pos, 1);                                       // type 3/4 elements
+static constexpr PduLayout D_ATTACH_DETACH_GROUP_IDENTITY = pduLayout("MM", "D-ATTACH/DETACH GROUP IDENTITY", 4, D_ATTACH_DETACH_GROUP_IDENTITY_FIELDS);
 
-        if (mBit)
-        {
-            parseType34Elements(pdu, pos);
-        }
-    }
+void Mm::parseDAttachDetachGroupIdentity(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_attach_detach_group_identity", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_ATTACH_DETACH_GROUP_IDENTITY, pdu);
 }
 
 /**
@@ -581,35 +560,20 @@ void Mm::parseDAttachDetachGroupIdentity(Pdu pdu)
  *
  */
 
-void Mm::parseDAttachDetachGroupIdentityAck(Pdu pdu)
-{
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_attach_detach_group_identity_ack", pdu.toString().c_str());
-
-    m_report->start("MM", "D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT", m_tetraTime, m_macAddress);
-
-    uint32_t pos = 4;                                                           // pdu type
-
-    // 16.10.12 Group identity accept/reject
-    m_report->add("All attachment/detachments accepted", boolToString(!pdu.getValue(pos, 1)));
-    pos += 1;
-
-    // reserved
-    pos += 1;
-
-    bool oBit = pdu.getValue(pos, 1);                                           // o-bit
-    pos += 1;
+static constexpr PduField D_ATTACH_DETACH_GROUP_IDENTITY_ACK_FIELDS[] = {
+    fieldEnum("All attachment/detachments accepted", 1, BOOL_NOT_NAMES),        // 16.10.12 Group identity accept/reject, 0 is accepted
+    fieldReserved(1),
+    fieldObit(),                                                                // there are type 2/3/4 elements
+    fieldMbit(),                                                                // type 3/4 elements
+};
 
-    if (oBit)                                                                   // there are type 2/3/4 elements
-    {
-        bool mBit = pdu.getValue(pos, 1);                                       // type 3/4 elements
+static constexpr PduLayout D_ATTACH_DETACH_GROUP_IDENTITY_ACK = pduLayout("MM", "D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT", 4, D_ATTACH_DETACH_GROUP_IDENTITY_ACK_FIELDS);
 
-        if (mBit)
-        {
-            parseType34Elements(pdu, pos);
-        }
-    }
+void Mm::parseDAttachDetachGroupIdentityAck(const Pdu & pdu)
+{
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_d_attach_detach_group_identity_ack", pdu.toString().c_str());
 
-    m_report->send();
+    reportPduLayout(D_ATTACH_DETACH_GROUP_IDENTITY_ACK, pdu);
 }
 
 /**
@@ -617,9 +581,9 @@ void Mm::parseDAttachDetachGroupIdentityAck(Pdu pdu)
  *
  */
 
-void Mm::parseMmPduNotSupported(Pdu pdu)
+void Mm::parseMmPduNotSupported(const Pdu & pdu)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_mm_pdu_function_not_supported", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_mm_pdu_function_not_supported", pdu.toString().c_str());
 
     m_report->start("MM", "MM PDU/FUNCTION NOT SUPPORTED", m_tetraTime, m_macAddress);
 
@@ -14,76 +14,76 @@ namespace Tetra {
         Mm(Log * log, Report * report);
         ~Mm();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
 
     private:
-        void parseDOtar(Pdu pdu);
-        void parseDOtarCckProvide(Pdu pdu);
-        void parseDOtarSckProvide(Pdu pdu);
-        void parseDOtarSckReject(Pdu pdu);
-        void parseDOtarGckProvide(Pdu pdu);
-        void parseDOtarGckReject(Pdu pdu);
-        void parseDOtarKeyAssociateDemand(Pdu pdu);
-        void parseDOtarNewcell(Pdu pdu);
-        void parseDOtarGskoProvide(Pdu pdu);
-        void parseDOtarGskoReject(Pdu pdu);
-        void parseDOtarKeyDeleteDemand(Pdu pdu);
-        void parseDOtarKeyStatusDemand(Pdu pdu);
-        void parseDOtarCmgGtsiProvide(Pdu pdu);
-        void parseDOtarDmSckActivate(Pdu pdu);
-        void parseDAuthentication(Pdu pdu);
-        void parseDAuthenticationDemand(Pdu pdu);
-        void parseDAuthenticationResponse(Pdu pdu);
-        void parseDAuthenticationResult(Pdu pdu);
-        void parseDAuthenticationReject(Pdu pdu);
-        void parseDCkChangeDemand(Pdu pdu);
-        void parseDDisable(Pdu pdu);
-        void parseDEnable(Pdu pdu);
-        void parseDLocationUpdateAccept(Pdu pdu);
-        void parseDLocationUpdateCommand(Pdu pdu);
-        void parseDLocationUpdateReject(Pdu pdu);
-        void parseDLocationUpdateProceeding(Pdu pdu);
-        void parseDAttachDetachGroupIdentity(Pdu pdu);
-        void parseDAttachDetachGroupIdentityAck(Pdu pdu);
-        void parseDMmStatus(Pdu pdu);
-        void parseDChangeOfEnergySavingModeRequest(Pdu pdu);
-        void parseDChangeOfEnergySavingModeResponse(Pdu pdu);
-        void parseDDualWatchModeResponse(Pdu pdu);
-        void parseDTerminatingDualWatchModeResponse(Pdu pdu);
-        void parseDChangeOfDualWatchModeRequest(Pdu pdu);
-        void parseDMsFrequencyBandsRequest(Pdu pdu);
-        void parseDDistanceReportingRequest(Pdu pdu);
-        void parseMmPduNotSupported(Pdu pdu);
+        void parseDOtar(const Pdu & pdu);
+        void parseDOtarCckProvide(const Pdu & pdu);
+        void parseDOtarSckProvide(const Pdu & pdu);
+        void parseDOtarSckReject(const Pdu & pdu);
+        void parseDOtarGckProvide(const Pdu & pdu);
+        void parseDOtarGckReject(const Pdu & pdu);
+        void parseDOtarKeyAssociateDemand(const Pdu & pdu);
+        void parseDOtarNewcell(const Pdu & pdu);
+        void parseDOtarGskoProvide(const Pdu & pdu);
+        void parseDOtarGskoReject(const Pdu & pdu);
+        void parseDOtarKeyDeleteDemand(const Pdu & pdu);
+        void parseDOtarKeyStatusDemand(const Pdu & pdu);
+        void parseDOtarCmgGtsiProvide(const Pdu & pdu);
+        void parseDOtarDmSckActivate(const Pdu & pdu);
+        void parseDAuthentication(const Pdu & pdu);
+        void parseDAuthenticationDemand(const Pdu & pdu);
+        void parseDAuthenticationResponse(const Pdu & pdu);
+        void parseDAuthenticationResult(const Pdu & pdu);
+        void parseDAuthenticationReject(const Pdu & pdu);
+        void parseDCkChangeDemand(const Pdu & pdu);
+        void parseDDisable(const Pdu & pdu);
+        void parseDEnable(const Pdu & pdu);
+        void parseDLocationUpdateAccept(const Pdu & pdu);
+        void parseDLocationUpdateCommand(const Pdu & pdu);
+        void parseDLocationUpdateReject(const Pdu & pdu);
+        void parseDLocationUpdateProceeding(const Pdu & pdu);
+        void parseDAttachDetachGroupIdentity(const Pdu & pdu);
+        void parseDAttachDetachGroupIdentityAck(const Pdu & pdu);
+        void parseDMmStatus(const Pdu & pdu);
+        void parseDChangeOfEnergySavingModeRequest(const Pdu & pdu);
+        void parseDChangeOfEnergySavingModeResponse(const Pdu & pdu);
+        void parseDDualWatchModeResponse(const Pdu & pdu);
+        void parseDTerminatingDualWatchModeResponse(const Pdu & pdu);
+        void parseDChangeOfDualWatchModeRequest(const Pdu & pdu);
+        void parseDMsFrequencyBandsRequest(const Pdu & pdu);
+        void parseDDistanceReportingRequest(const Pdu & pdu);
+        void parseMmPduNotSupported(const Pdu & pdu);
 
-        uint64_t parseType34Elements(Pdu pdu, uint64_t pos);
-        uint64_t parseAddressExtension(Pdu pdu, uint64_t pos);
-        uint64_t parseAuthenticationChallenge(Pdu pdu, uint64_t pos);
-        uint64_t parseAuthenticationDownlink(Pdu pdu, uint64_t pos);
-        uint64_t parseCellTypeControl(Pdu pdu, uint64_t pos);
-        uint64_t parseCellTypeListControl(Pdu pdu, uint64_t pos, uint8_t& cellTypeCount);
-        uint64_t parseCckInformation(Pdu pdu, uint64_t pos);
-        uint64_t parseCckLocationAreaInformation(Pdu pdu, uint64_t pos);
-        uint64_t parseCipheringParameters(Pdu pdu, uint64_t pos);
-        uint64_t parseCkProvisioningInformation(Pdu pdu, uint64_t pos);
-        uint64_t parseEnergySavingInformation(Pdu pdu, uint64_t pos);
-        uint64_t parseGckData(Pdu pdu, uint64_t pos);
-        uint64_t parseGckKeyAndId(Pdu pdu, uint64_t pos);
-        uint64_t parseGckRejected(Pdu pdu, uint64_t pos);
-        uint64_t parseGroupIdentityAttachment(Pdu pdu, uint64_t pos);
-        uint64_t parseGroupIdentityDownlink(Pdu pdu, uint64_t pos);
-        uint64_t parseGroupIdentityLocationAccept(Pdu pdu, uint64_t pos);
-        uint64_t parseGISRI(Pdu pdu, uint64_t pos);
-        uint64_t parseGroupReportResponse(Pdu pdu, uint64_t pos);
-        uint64_t parseLocationAreaList(Pdu pdu, uint64_t pos);
-        uint64_t parseLocationAreaRange(Pdu pdu, uint64_t pos);
-        uint64_t parseNewRegisteredArea(Pdu pdu, uint64_t pos);
-        uint64_t parseProprietary(Pdu pdu, uint64_t pos);
-        uint64_t parseScchInformationAndDistribution(Pdu pdu, uint64_t pos);
-        uint64_t parseSckData(Pdu pdu, uint64_t pos);
-        uint64_t parseSckInformation(Pdu pdu, uint64_t pos);
-        uint64_t parseSckKeyAndId(Pdu pdu, uint64_t pos);
-        uint64_t parseSckRejected(Pdu pdu, uint64_t pos);
-        uint64_t parseSecurityDownlink(Pdu pdu, uint64_t pos);
+        uint64_t parseType34Elements(const Pdu & pdu, uint64_t pos);
+        uint64_t parseAddressExtension(const Pdu & pdu, uint64_t pos);
+        uint64_t parseAuthenticationChallenge(const Pdu & pdu, uint64_t pos);
+        uint64_t parseAuthenticationDownlink(const Pdu & pdu, uint64_t pos);
+        uint64_t parseCellTypeControl(const Pdu & pdu, uint64_t pos);
+        uint64_t parseCellTypeListControl(const Pdu & pdu, uint64_t pos, uint8_t& cellTypeCount);
+        uint64_t parseCckInformation(const Pdu & pdu, uint64_t pos);
+        uint64_t parseCckLocationAreaInformation(const Pdu & pdu, uint64_t pos);
+        uint64_t parseCipheringParameters(const Pdu & pdu, uint64_t pos);
+        uint64_t parseCkProvisioningInformation(const Pdu & pdu, uint64_t pos);
+        uint64_t parseEnergySavingInformation(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGckData(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGckKeyAndId(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGckRejected(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGroupIdentityAttachment(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGroupIdentityDownlink(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGroupIdentityLocationAccept(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGISRI(const Pdu & pdu, uint64_t pos);
+        uint64_t parseGroupReportResponse(const Pdu & pdu, uint64_t pos);
+        uint64_t parseLocationAreaList(const Pdu & pdu, uint64_t pos);
+        uint64_t parseLocationAreaRange(const Pdu & pdu, uint64_t pos);
+        uint64_t parseNewRegisteredArea(const Pdu & pdu, uint64_t pos);
+        uint64_t parseProprietary(const Pdu & pdu, uint64_t pos);
+        uint64_t parseScchInformationAndDistribution(const Pdu & pdu, uint64_t pos);
+        uint64_t parseSckData(const Pdu & pdu, uint64_t pos);
+        uint64_t parseSckInformation(const Pdu & pdu, uint64_t pos);
+        uint64_t parseSckKeyAndId(const Pdu & pdu, uint64_t pos);
+        uint64_t parseSckRejected(const Pdu & pdu, uint64_t pos);
+        uint64_t parseSecurityDownlink(const Pdu & pdu, uint64_t pos);
 
         std::string valueToString(std::string key, uint32_t val);
         std::string getMapValue(std::map<uint32_t, std::string> informationElement, uint32_t val);
@@ -7,7 +7,7 @@ using namespace Tetra;
  *
  */
 
-uint64_t Mm::parseType34Elements(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseType34Elements(const Pdu & pdu, uint64_t pos)
 {
     while (pdu.getValue(pos, 1))                                                // repeat for all type 3/4 elements
     {
@@ -134,9 +134,9 @@ uint64_t Mm::parseType34Elements(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseAddressExtension(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseAddressExtension(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_address_extension", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_address_extension", pdu.toString().c_str());
 
     m_report->add("MCC", pdu.getValue(pos, 10));
     pos += 10;
@@ -151,9 +151,9 @@ uint64_t Mm::parseAddressExtension(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseAuthenticationChallenge(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseAuthenticationChallenge(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_authentication_challenge", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_authentication_challenge", pdu.toString().c_str());
 
     m_report->add("Random challenge RAND1", pdu.getValue(pos, 80));
     pos += 80;
@@ -169,9 +169,9 @@ uint64_t Mm::parseAuthenticationChallenge(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseAuthenticationDownlink(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseAuthenticationDownlink(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_authentication_downlink", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_authentication_downlink", pdu.toString().c_str());
 
     std::string authSuccess = pdu.getValue(pos, 1) ? "true" : "false";
     pos += 1;
@@ -196,9 +196,9 @@ uint64_t Mm::parseAuthenticationDownlink(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseCckInformation(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseCckInformation(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cck_information", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cck_information", pdu.toString().c_str());
 
     m_report->add("CCK identifier", pdu.getValue(pos, 16));
     pos += 16;
@@ -225,9 +225,9 @@ uint64_t Mm::parseCckInformation(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseCckLocationAreaInformation(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseCckLocationAreaInformation(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cck_la_information", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cck_la_information", pdu.toString().c_str());
 
     uint8_t type = pdu.getValue(pos, 2);
     std::string txt = valueToString("Type", type);
@@ -259,9 +259,9 @@ uint64_t Mm::parseCckLocationAreaInformation(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseCellTypeControl(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseCellTypeControl(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cell_type_control", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cell_type_control", pdu.toString().c_str());
 
     bool revertToUserApplication = pdu.getValue(pos, 1);
     m_report->add("Revert to user application setting", boolToString(revertToUserApplication));
@@ -298,9 +298,9 @@ uint64_t Mm::parseCellTypeControl(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseCellTypeListControl(Pdu pdu, uint64_t pos, uint8_t& cellTypeCount)
+uint64_t Mm::parseCellTypeListControl(const Pdu & pdu, uint64_t pos, uint8_t& cellTypeCount)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cell_type_list_control", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_cell_type_list_control", pdu.toString().c_str());
 
     uint8_t cellTypeListControl = pdu.getValue(pos, 4);
     bool ordered = false;
@@ -325,9 +325,9 @@ uint64_t Mm::parseCellTypeListControl(Pdu pdu, uint64_t pos, uint8_t& cellTypeCo
  *
  */
 
-uint64_t Mm::parseCipheringParameters(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseCipheringParameters(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_ciphering_parameters", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_ciphering_parameters", pdu.toString().c_str());
 
     m_report->add("KSG number", pdu.getValue(pos, 4));
     pos += 4;
@@ -365,9 +365,9 @@ uint64_t Mm::parseCipheringParameters(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseCkProvisioningInformation(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseCkProvisioningInformation(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_ck_provisioning_information", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_ck_provisioning_information", pdu.toString().c_str());
 
     bool sckProvisionFlag = pdu.getValue(pos, 1);
     pos += 1;
@@ -392,9 +392,9 @@ uint64_t Mm::parseCkProvisioningInformation(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseEnergySavingInformation(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseEnergySavingInformation(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_energy_saving_information", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_energy_saving_information", pdu.toString().c_str());
 
     uint8_t energySavingMode = pdu.getValue(pos, 3);
 
@@ -424,9 +424,9 @@ uint64_t Mm::parseEnergySavingInformation(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGckData(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGckData(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_data", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_data", pdu.toString().c_str());
 
     m_report->add("GCK Number", pdu.getValue(pos, 16));
     pos += 16;
@@ -443,9 +443,9 @@ uint64_t Mm::parseGckData(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGckKeyAndId(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGckKeyAndId(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_key_and_id", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_key_and_id", pdu.toString().c_str());
 
     m_report->add("GCKN", pdu.getValue(pos, 16));
     pos += 16;
@@ -464,9 +464,9 @@ uint64_t Mm::parseGckKeyAndId(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGckRejected(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGckRejected(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_rejected", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gck_rejected", pdu.toString().c_str());
 
     std::string txt = valueToString("OTAR reject reason", pdu.getValue(pos, 3));
     m_report->add("OTAR reject reason", txt);
@@ -494,9 +494,9 @@ uint64_t Mm::parseGckRejected(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGroupIdentityAttachment(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGroupIdentityAttachment(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_attachment", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_attachment", pdu.toString().c_str());
 
     std::string txt = valueToString("Group identity attachment lifetime", pdu.getValue(pos, 2));
     m_report->add("Group identity attachment lifetime", txt);
@@ -514,9 +514,9 @@ uint64_t Mm::parseGroupIdentityAttachment(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGroupIdentityDownlink(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGroupIdentityDownlink(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_downlink", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_downlink", pdu.toString().c_str());
 
     bool attachDetachType = pdu.getValue(pos, 1);
     pos += 1;
@@ -568,9 +568,9 @@ uint64_t Mm::parseGroupIdentityDownlink(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGroupIdentityLocationAccept(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGroupIdentityLocationAccept(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_location_accept", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_identity_location_accept", pdu.toString().c_str());
 
     // 16.10.12 Group identity accept/reject
     m_report->add("All attachment/detachments accepted", boolToString(!pdu.getValue(pos, 1)));
@@ -596,9 +596,9 @@ uint64_t Mm::parseGroupIdentityLocationAccept(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGISRI(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGISRI(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gisri", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_gisri", pdu.toString().c_str());
 
     uint64_t numberOfGroups = pdu.getValue(pos, 5);
     m_report->add("Number of groups", pdu.getValue(pos, 5));
@@ -638,9 +638,9 @@ uint64_t Mm::parseGISRI(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseGroupReportResponse(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseGroupReportResponse(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_report_response", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_group_report_response", pdu.toString().c_str());
 
     m_report->add("group report response", pdu.getValue(pos, 1));
     pos += 1;
@@ -653,9 +653,9 @@ uint64_t Mm::parseGroupReportResponse(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseLocationAreaList(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseLocationAreaList(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_location_area_list", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_location_area_list", pdu.toString().c_str());
 
     uint8_t numberOfLAs = pdu.getValue(pos, 4);
     m_report->add("Number of location areas", pdu.getValue(pos, 4));
@@ -675,9 +675,9 @@ uint64_t Mm::parseLocationAreaList(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseLocationAreaRange(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseLocationAreaRange(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_location_area_range", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_location_area_range", pdu.toString().c_str());
 
     m_report->add("LLAV", pdu.getValue(pos, 14));
     pos += 14;
@@ -693,9 +693,9 @@ uint64_t Mm::parseLocationAreaRange(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseNewRegisteredArea(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseNewRegisteredArea(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_new_registered_area", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_new_registered_area", pdu.toString().c_str());
 
     std::string txt = valueToString("LA timer", pdu.getValue(pos, 3));
     m_report->add("LA timer", txt);
@@ -736,9 +736,9 @@ uint64_t Mm::parseNewRegisteredArea(Pdu pdu, uint64_t pos)
  * @brief Proprietary - 16.10.41 / Annex H.1
  *
  */
-uint64_t Mm::parseProprietary(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseProprietary(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "parse_proprietary", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "parse_proprietary", pdu.toString().c_str());
 
     uint32_t proprietaryElementOwner = pdu.getValue(pos, 8);
     m_report->add("Proprietary element owner", pdu.getValue(pos, 8));
@@ -761,9 +761,9 @@ uint64_t Mm::parseProprietary(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseScchInformationAndDistribution(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseScchInformationAndDistribution(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_scch_information_and_distribution", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_scch_information_and_distribution", pdu.toString().c_str());
 
     uint8_t scchInformation = pdu.getValue(pos, 4);
 
@@ -785,9 +785,9 @@ uint64_t Mm::parseScchInformationAndDistribution(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseSckData(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseSckData(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_data", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_data", pdu.toString().c_str());
 
     m_report->add("SCK Number", pdu.getValue(pos, 5));
     pos += 5;
@@ -803,9 +803,9 @@ uint64_t Mm::parseSckData(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseSckInformation(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseSckInformation(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_information", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_information", pdu.toString().c_str());
 
     bool sessionKey = pdu.getValue(pos, 1);
     pos += 1;
@@ -848,9 +848,9 @@ uint64_t Mm::parseSckInformation(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseSckKeyAndId(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseSckKeyAndId(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_key_and_id", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_key_and_id", pdu.toString().c_str());
 
     m_report->add("SCKN", pdu.getValue(pos, 5));
     pos += 5;
@@ -883,9 +883,9 @@ uint64_t Mm::parseSckKeyAndId(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseSckRejected(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseSckRejected(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_rejected", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_sck_rejected", pdu.toString().c_str());
 
     std::string txt = valueToString("OTAR reject reason", pdu.getValue(pos, 3));
     m_report->add("OTAR reject reason", txt);
@@ -902,9 +902,9 @@ uint64_t Mm::parseSckRejected(Pdu pdu, uint64_t pos)
  *
  */
 
-uint64_t Mm::parseSecurityDownlink(Pdu pdu, uint64_t pos)
+uint64_t Mm::parseSecurityDownlink(const Pdu & pdu, uint64_t pos)
 {
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_security_downlink", pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - pdu = %s\n", "mm_parse_security_downlink", pdu.toString().c_str());
 
     m_report->add("Authentication successful", boolToString(pdu.getValue(pos, 1)));
     pos += 1;
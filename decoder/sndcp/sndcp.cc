@@ -27,11 +27,11 @@ Sndcp::~Sndcp()
  *
  */
 
-void Sndcp::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
+void Sndcp::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_sndcp", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s\n", "service_sndcp", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str());
 
     m_report->start("SNDCP", "RAW-DATA", tetraTime, macAddress);
     m_report->add("data", pdu);
@@ -14,7 +14,7 @@ namespace Tetra {
         Sndcp(Log * log, Report * report);
         ~Sndcp();
 
-        void service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
+        void service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress);
     };
 
 };
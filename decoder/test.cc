@@ -0,0 +1,656 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "cmce/cmce.h"
+#include "common/crc.h"
+#include "common/pdu.h"
+#include "common/scrambling.h"
+#include "generator/generator.h"
+#include "mac/mac.h"
+#include "mac/viterbicodec.h"
+#include "mm/mm.h"
+
+/**
+ * @brief Decoder self tests, built with "make test" and run with "make check"
+ *
+ * Each test prints its result and returns true when passed.
+ *
+ */
+
+using namespace Tetra;
+
+/**
+ * @brief Viterbi decoders of the 16 states rate 1/4 code give the same output
+ *
+ * Blocks go through decodeScalar() (reference), decodeSse2(), the 16 lanes hard
+ * batch and the soft batch decoders, with depuncture erasures (value 2). Blocks are
+ * random 0, 1 and erasures, or encoded terminated blocks punctured to rate 2/3
+ * (8.2.3.1.3) with up to 2 bit errors.
+ *
+ *   - SSE2 and hard batch outputs must be the same as scalar output
+ *   - soft bits are +/-64 (0 for erasures), so soft path metrics order paths as the
+ *     hard ones. The soft batch starts traceback from state 0 (tail bits) while hard
+ *     decoders start from the best state: when scalar output ends with 4 zero bits
+ *     (traceback from state 0), soft output must be the same, otherwise it must end
+ *     with 4 zero bits
+ *   - encoded blocks without error must be decoded to the original bits
+ *
+ * Then blocks of random soft bits over the full int8 range go through the soft
+ * batch decoder, which must give the same output as the scalar soft decoder
+ * Mac::viterbiDecode1614() (both start traceback from state 0).
+ *
+ */
+
+static bool testViterbi1614()
+{
+    static const ViterbiCodec1614 codec;                                        // large tables, not on stack
+
+    const std::size_t LANES    = ViterbiCodec1614::BATCH_LANES;
+    const std::size_t LENGTHS[] = {80, 144, 288};                               // decoded bits of BSCH, SCH/HD (BNCH, STCH), SCH/F
+    const uint8_t ERASURE      = ViterbiCodec1614::ERASURE;
+
+    std::mt19937 rng(1614);
+    std::size_t blocks = 0;
+    std::size_t errors = 0;
+
+    for (std::size_t round = 0; round < 200; round++)
+    {
+        const std::size_t symbols = LENGTHS[round % 3];
+        const std::size_t len     = 4 * symbols;
+        const bool bRandom        = (round % 2) == 0;
+
+        std::vector<std::vector<uint8_t>> msg(LANES, std::vector<uint8_t>(symbols));
+        std::vector<std::vector<uint8_t>> hard(LANES, std::vector<uint8_t>(len));
+        std::vector<std::vector<int8_t>>  soft(LANES, std::vector<int8_t>(len));
+        std::vector<std::vector<uint8_t>> res[4];
+        std::vector<std::size_t> bitErrors(LANES, 0);
+
+        for (std::size_t idx = 0; idx < 4; idx++)
+        {
+            res[idx].assign(LANES, std::vector<uint8_t>(symbols, 0xff));
+        }
+
+        const std::size_t count = 1 + rng() % LANES;                            // partial batches too
+
+        for (std::size_t lane = 0; lane < count; lane++)
+        {
+            if (bRandom)
+            {
+                for (std::size_t pos = 0; pos < len; pos++)
+                {
+                    hard[lane][pos] = (uint8_t)(rng() % 3);
+                }
+            }
+            else
+            {
+                for (std::size_t pos = 0; pos < symbols; pos++)
+                {
+                    msg[lane][pos] = (pos + 4 < symbols) ? (uint8_t)(rng() & 1) : 0; // tail bits
+                }
+                codec.encode(msg[lane].data(), symbols, hard[lane].data());
+
+                for (std::size_t pos = 0; pos < len; pos++)
+                {
+                    const std::size_t bit = pos % 8;                            // rate 2/3: mother bits 1, 2 and 5 of each 8 are sent
+                    if ((bit != 0) && (bit != 1) && (bit != 4))
+                    {
+                        hard[lane][pos] = ERASURE;
+                    }
+                }
+
+                bitErrors[lane] = rng() % 3;
+                for (std::size_t err = 0; err < bitErrors[lane]; err++)
+                {
+                    const std::size_t pos = 8 * (rng() % (len / 8)) + ((rng() & 1) ? 1 : 4);
+                    hard[lane][pos] ^= 1;
+                }
+            }
+
+            for (std::size_t pos = 0; pos < len; pos++)
+            {
+                const uint8_t bit = hard[lane][pos];
+                soft[lane][pos] = (bit == ERASURE) ? 0 : (bit ? 64 : -64);
+            }
+        }
+
+        const uint8_t * hardIn[LANES];
+        const int8_t  * softIn[LANES];                                          // only used by SSE2 decoders
+        uint8_t * batchOut[LANES];
+        uint8_t * softOut[LANES];
+        for (std::size_t lane = 0; lane < LANES; lane++)
+        {
+            hardIn[lane]   = hard[lane].data();
+            softIn[lane]   = soft[lane].data();
+            batchOut[lane] = res[2][lane].data();
+            softOut[lane]  = res[3][lane].data();
+        }
+
+        for (std::size_t lane = 0; lane < count; lane++)
+        {
+            codec.decodeScalar(hardIn[lane], len, res[0][lane].data());
+#if defined(__SSE2__)
+            codec.decodeSse2(hardIn[lane], len, res[1][lane].data());
+#else
+            res[1][lane] = res[0][lane];                                        // no SIMD decoder to check
+            res[3][lane] = res[0][lane];
+            std::fill(res[3][lane].end() - 4, res[3][lane].end(), 0);
+#endif
+        }
+        codec.decodeBatch(hardIn, count, len, batchOut);
+#if defined(__SSE2__)
+        codec.decodeSoftBatch(softIn, count, len, softOut);
+#endif
+
+        for (std::size_t lane = 0; lane < count; lane++)
+        {
+            bool bOk = (res[1][lane] == res[0][lane]) && (res[2][lane] == res[0][lane]);
+
+            const std::vector<uint8_t> tail(4, 0);
+            if (std::equal(tail.begin(), tail.end(), res[0][lane].end() - 4))   // scalar traceback from state 0
+            {
+                bOk = bOk && (res[3][lane] == res[0][lane]);
+            }
+            else
+            {
+                bOk = bOk && std::equal(tail.begin(), tail.end(), res[3][lane].end() - 4);
+            }
+
+            if (!bRandom && (bitErrors[lane] == 0))
+            {
+                bOk = bOk && (res[0][lane] == msg[lane]);
+            }
+
+            if (!bOk)
+            {
+                errors++;
+                printf("  viterbi 16-14: mismatch round %zu lane %zu (%zu symbols, %s, %zu bit errors)\n", round, lane, symbols, bRandom ? "random" : "encoded", bitErrors[lane]);
+            }
+            blocks++;
+        }
+    }
+
+#if defined(__SSE2__)
+    for (std::size_t round = 0; round < 60; round++)                            // random soft bits, scalar soft decoder as reference
+    {
+        const std::size_t symbols = LENGTHS[round % 3];
+        const std::size_t len     = 4 * symbols;
+        const std::size_t count   = 1 + rng() % LANES;
+
+        std::vector<std::vector<int8_t>>  soft(LANES, std::vector<int8_t>(len));
+        std::vector<std::vector<uint8_t>> expected(LANES, std::vector<uint8_t>(symbols, 0xff));
+        std::vector<std::vector<uint8_t>> res(LANES, std::vector<uint8_t>(symbols, 0xff));
+
+        const int8_t * softIn[LANES];
+        uint8_t * softOut[LANES];
+        for (std::size_t lane = 0; lane < LANES; lane++)
+        {
+            for (std::size_t pos = 0; pos < len; pos++)
+            {
+                soft[lane][pos] = (int8_t)(rng() & 0xff);                       // full range, -128 included
+            }
+            softIn[lane]  = soft[lane].data();
+            softOut[lane] = res[lane].data();
+        }
+
+        codec.decodeSoftBatch(softIn, count, len, softOut);
+
+        for (std::size_t lane = 0; lane < count; lane++)
+        {
+            Mac::viterbiDecode1614(Span<const int8_t>(soft[lane].data(), len), Span<uint8_t>(expected[lane].data(), symbols));
+
+            if (res[lane] != expected[lane])
+            {
+                errors++;
+                printf("  viterbi 16-14: soft mismatch round %zu lane %zu (%zu symbols, random soft bits)\n", round, lane, symbols);
+            }
+            blocks++;
+        }
+    }
+#endif
+
+    printf("%s viterbi 16-14: %zu blocks, %zu mismatches\n", errors ? "FAIL" : "PASS", blocks, errors);
+
+    return errors == 0;
+}
+
+/**
+ * @brief Cached scrambling sequences are the generated ones
+ *
+ * Codes are requested in cycles longer than the thread and shared caches, with
+ * the synchronisation code in between like synchronisation bursts, so lookups
+ * go through thread cache hits, shared cache hits and generation.
+ *
+ */
+
+static bool testScramblingCache()
+{
+    const std::size_t CODES = ScramblingCache::CACHE_SIZE + 4;
+    const std::size_t LEN   = ScramblingCache::MAX_LEN;
+
+    std::size_t errors = 0;
+
+    for (std::size_t round = 0; round < 4; round++)
+    {
+        for (std::size_t step = 0; step < (round + 1) * CODES; step++)
+        {
+            const uint32_t code = (step % 2) ? ScramblingCache::BSCH_CODE : (uint32_t)(0x12345 + 0x1000 * (step / 2 % (CODES / (round + 1) + 1)));
+
+            uint8_t expected[LEN];
+            ScramblingCache::generate(code, expected, LEN);
+
+            const ScramblingCache::Keystream * keystream = ScramblingCache::get(code);
+            if ((keystream->scramblingCode != code) || (memcmp(keystream->bits, expected, LEN) != 0))
+            {
+                errors++;
+                printf("  scrambling cache: wrong sequence for code 0x%08x\n", code);
+            }
+
+            uint8_t block[LEN];
+            ScramblingCache::scramble(expected, block, LEN, code);              // sequence XOR itself
+            for (std::size_t idx = 0; idx < LEN; idx++)
+            {
+                if (block[idx] != 0)
+                {
+                    errors++;
+                    printf("  scrambling cache: wrong scrambling for code 0x%08x\n", code);
+                    break;
+                }
+            }
+        }
+    }
+
+    printf("%s scrambling cache: %zu errors\n", errors ? "FAIL" : "PASS", errors);
+
+    return errors == 0;
+}
+
+/**
+ * @brief Reed-Muller (30,14) decoder corrects up to 2 bit errors - 8.2.3.3
+ *
+ * All 2^14 messages are encoded with the generator encoder, then decoded without
+ * error and with every 1 and 2 bit error pattern over the 30 bits codeword. The
+ * code minimum distance is 8, so the original message must always be decoded.
+ *
+ */
+
+static bool testReedMuller3014()
+{
+    std::vector<uint32_t> patterns(1, 0);                                       // no error
+    for (int first = 0; first < 30; first++)
+    {
+        patterns.push_back(1u << first);                                        // 1 error
+        for (int second = first + 1; second < 30; second++)
+        {
+            patterns.push_back((1u << first) | (1u << second));                 // 2 errors
+        }
+    }
+
+    std::size_t words  = 0;
+    std::size_t errors = 0;
+
+    std::vector<uint8_t> msg(14);
+    std::vector<uint8_t> word(30);
+    uint8_t res[14];
+
+    for (uint32_t val = 0; val < (1u << 14); val++)
+    {
+        for (std::size_t idx = 0; idx < 14; idx++)
+        {
+            msg[idx] = (val >> idx) & 1;
+        }
+        const std::vector<uint8_t> codeword = BurstGenerator::reedMuller3014Encode(msg);
+
+        for (std::size_t pat = 0; pat < patterns.size(); pat++)
+        {
+            for (std::size_t idx = 0; idx < 30; idx++)
+            {
+                word[idx] = codeword[idx] ^ ((patterns[pat] >> idx) & 1);
+            }
+
+            Mac::reedMuller3014Decode(word, Span<uint8_t>(res, 14));
+            if (memcmp(res, msg.data(), 14) != 0)
+            {
+                if (errors < 10)
+                {
+                    printf("  reed-muller 30-14: wrong message 0x%04x with error pattern 0x%08x\n", val, patterns[pat]);
+                }
+                errors++;
+            }
+            words++;
+        }
+    }
+
+    printf("%s reed-muller 30-14: %zu words, %zu wrong messages\n", errors ? "FAIL" : "PASS", words, errors);
+
+    return errors == 0;
+}
+
+/**
+ * @brief CRC-32 over packed words is the same as over unpacked bits
+ *
+ * Random blocks of 0 to 700 bits, starting at a random position of a PDU, are
+ * processed 64 bits at a time with Pdu::getValue() like Llc::checkFcs(). Half
+ * of them end with their complemented CRC and must give the FCS residue.
+ *
+ */
+
+static bool testCrc32Words()
+{
+    std::mt19937 rng(32);
+    std::size_t errors = 0;
+
+    for (std::size_t round = 0; round < 2000; round++)
+    {
+        const std::size_t offset = rng() % 80;
+        std::vector<uint8_t> bits(offset + rng() % 701);
+        for (std::size_t idx = 0; idx < bits.size(); idx++)
+        {
+            bits[idx] = (uint8_t)(rng() & 1);
+        }
+
+        if ((round % 2) && (bits.size() >= offset + 32))                        // valid FCS at the end
+        {
+            const std::size_t len = bits.size() - offset - 32;
+            const uint32_t fcs    = ~Crc::crc32(bits.data() + offset, len);
+            for (std::size_t idx = 0; idx < 32; idx++)
+            {
+                bits[offset + len + idx] = (fcs >> (31 - idx)) & 1;
+            }
+        }
+
+        const Pdu pdu(bits);
+        uint32_t crc = 0xFFFFFFFF;
+        for (std::size_t idx = offset; idx < pdu.size(); idx += 64)
+        {
+            const std::size_t len = (pdu.size() - idx < 64) ? pdu.size() - idx : 64;
+            crc = Crc::crc32(pdu.getValue(idx, (uint8_t)len), len, crc);
+        }
+
+        bool bOk = (crc == Crc::crc32(bits.data() + offset, bits.size() - offset));
+        if ((round % 2) && (bits.size() >= offset + 32))
+        {
+            bOk = bOk && (crc == Crc::CRC32_RESIDUE);
+        }
+
+        if (!bOk)
+        {
+            errors++;
+            printf("  crc-32 words: mismatch round %zu (%zu bits from %zu)\n", round, bits.size() - offset, offset);
+        }
+    }
+
+    printf("%s crc-32 words: 2000 blocks, %zu mismatches\n", errors ? "FAIL" : "PASS", errors);
+
+    return errors == 0;
+}
+
+/**
+ * @brief Expected report of a PDU
+ *
+ */
+
+struct ReportGolden {
+    char layer;                                                                 // 'C' CMCE, 'M' MM
+    const char * bits;                                                          // PDU bits, fields separated by spaces
+    const char * report;                                                        // report without time
+};
+
+/**
+ * @brief Reports of the parsers driven by PDU layouts, made by the hand-written
+ *        parsers they replaced
+ *
+ * PDUs are without O-bit, with all P-bits, with alternate P-bits, with each
+ * address type, truncated, and with type 3/4 elements. D-ALERT and
+ * D-CALL PROCEEDING with O-bit set report type 2 elements the hand-written
+ * parsers stopped before.
+ *
+ */
+
+static const ReportGolden REPORT_GOLDENS[] = {
+    // CMCE D-ALERT
+    {'C', "00000 01100000100000 110 0 1 1",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":6176,\"call timeout, setup phase\":6,\"simplex/duplex operation\":1,\"call queued\":1}"},
+    {'C', "00000 11010111111011 000 0 0 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":13819,\"call timeout, setup phase\":0,\"simplex/duplex operation\":0,\"call queued\":1}"},
+    {'C', "00000 11011111001010 010 0 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":14282,\"call timeout, setup phase\":2,\"simplex/duplex operation\":1,\"call queued\":0}"},
+    {'C', "00000 01100000100000 110 0 1 1 1 1 00010001 1 101100 1",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":6176,\"call timeout, setup phase\":6,\"simplex/duplex operation\":1,\"call queued\":1,\"basic service information\":17,\"notification indicator\":44}"},
+
+    // CMCE D-CALL PROCEEDING
+    {'C', "00001 00001010110110 110 1 1",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":694,\"call timeout, setup phase\":6,\"hook method selection\":1,\"simplex/duplex selection\":1}"},
+    {'C', "00001 01000001011101 000 0 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4189,\"call timeout, setup phase\":0,\"hook method selection\":0,\"simplex/duplex selection\":1}"},
+    {'C', "00001 01101100100100 000 1 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":6948,\"call timeout, setup phase\":0,\"hook method selection\":1,\"simplex/duplex selection\":1}"},
+    {'C', "00001 00001010110110 110 1 1 1 0 1 011 1 000111 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-ALERT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":694,\"call timeout, setup phase\":6,\"hook method selection\":1,\"simplex/duplex selection\":1,\"call status\":3,\"notification indicator\":7}"},
+
+    // CMCE D-CALL RESTORE
+    {'C', "01110 00011111110110 10 1 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CALL RESTORE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":2038,\"transmission grant\":2,\"transmission request permission\":1,\"reset call time-out timer T310\":1}"},
+    {'C', "01110 11010101000011 00 1 1 1 1 11001011011000 1 1111 1 100 1 010100001 1 110100 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CALL RESTORE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":13635,\"transmission grant\":0,\"transmission request permission\":1,\"reset call time-out timer T310\":1,\"new call identifier\":13016,\"call time-out\":15,\"call status\":4,\"modify\":161,\"notification indicator\":52}"},
+    {'C', "01110 11101011001010 00 1 0 1 0 1 1000 0 1 011110000 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CALL RESTORE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":15050,\"transmission grant\":0,\"transmission request permission\":1,\"reset call time-out timer T310\":0,\"call time-out\":8,\"modify\":240}"},
+
+    // CMCE D-CONNECT
+    {'C', "00010 10000110010011 0001 1 1 11 1 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":8595,\"call timeout\":1,\"hook method selection\":1,\"simplex/duplex selection\":1,\"transmission grant\":3,\"transmission request permission\":1,\"call ownership\":1}"},
+    {'C', "00010 00011001001001 1001 1 0 01 0 0 1 1 1010 1 00101001 1 100111100101111100100001 1 011101 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1609,\"call timeout\":9,\"hook method selection\":1,\"simplex/duplex selection\":0,\"transmission grant\":1,\"transmission request permission\":0,\"call ownership\":0,\"call priority\":10,\"basic service information\":41,\"temporary address\":10379041,\"notification indicator\":29}"},
+    {'C', "00010 00010010100011 0001 0 1 00 1 1 1 0 1 00100000 0 1 101110 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1187,\"call timeout\":1,\"hook method selection\":0,\"simplex/duplex selection\":1,\"transmission grant\":0,\"transmission request permission\":1,\"call ownership\":1,\"basic service information\":32,\"notification indicator\":46}"},
+
+    // CMCE D-CONNECT ACK
+    {'C', "00011 11100000000010 1111 00 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT ACK\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":14338,\"call timeout\":15,\"transmission grant\":0,\"transmission request permission\":1}"},
+    {'C', "00011 00101100000011 0001 11 1 1 1 001110 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT ACK\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":2819,\"call timeout\":1,\"transmission grant\":3,\"transmission request permission\":1,\"notification indicator\":14}"},
+    {'C', "00011 11000101101100 0110 11 1 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-CONNECT ACK\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":12652,\"call timeout\":6,\"transmission grant\":3,\"transmission request permission\":1}"},
+
+    // CMCE D-DISCONNECT
+    {'C', "00100 01110010011010 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-DISCONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":7322,\"disconnect cause\":0}"},
+    {'C', "00100 11001101111111 0 1 1 100111 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-DISCONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":13183,\"disconnect cause\":0,\"notification indicator\":39}"},
+    {'C', "00100 10000001001101 1 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-DISCONNECT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":8269,\"disconnect cause\":1}"},
+
+    // CMCE D-INFO
+    {'C', "00101 01111011100101 0 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-INFO\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":7909,\"reset call time-out timer (T310)\":0,\"poll request\":0}"},
+    {'C', "00101 11010001111100 1 0 1 1 01001000011010 1 0010 1 000 1 1 1 011010001 1 110 1 110100000111111101101010 1 011000 1 101000 1 111101 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-INFO\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":13436,\"reset call time-out timer (T310)\":1,\"poll request\":0,\"new call identifier\":4634,\"call time-out\":2,\"call time-out setup phase (T301, T302)\":0,\"call ownership\":1,\"modify\":209,\"call status\":6,\"temporary address\":13664106,\"notification indicator\":24,\"poll response percentage\":40,\"poll response number\":61}"},
+    {'C', "00101 01110101000011 0 0 1 0 1 1111 0 1 0 0 1 011 0 1 100111 0 1 100100 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-INFO\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":7491,\"reset call time-out timer (T310)\":0,\"poll request\":0,\"call time-out\":15,\"call ownership\":0,\"call status\":3,\"notification indicator\":39,\"poll response number\":36}"},
+
+    // CMCE D-RELEASE
+    {'C', "00110 01011001101101 11110 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-RELEASE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":5741,\"disconnect cause\":30}"},
+    {'C', "00110 00010000011011 11010 1 1 001000 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-RELEASE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1051,\"disconnect cause\":26,\"notification indicator\":8}"},
+    {'C', "00110 00011111111011 00010 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-RELEASE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":2043,\"disconnect cause\":2}"},
+
+    // CMCE D-SETUP
+    {'C', "00111 00111011111001 1010 0 1 10100010 11 0 0011 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":3833,\"call timeout\":10,\"hook method selection\":0,\"simplex/duplex selection\":1,\"basic service information\":162,\"transmission grant\":3,\"transmission request permission\":0,\"call priority\":3}"},
+    {'C', "00111 11101100110010 0010 1 1 11000010 01 0 0010 1 1 101000 1 100100100100100111010100 1 00 11100101 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":15154,\"call timeout\":2,\"hook method selection\":1,\"simplex/duplex selection\":1,\"basic service information\":194,\"transmission grant\":1,\"transmission request permission\":0,\"call priority\":2,\"notification indicator\":40,\"temporary address\":9587156,\"calling party type identifier\":0,\"calling party ssi\":229}"},
+    {'C', "00111 10011110011001 1100 1 1 01110011 01 0 0101 1 1 011111 1 011111110000011110111101 1 01 011101010001111111001011 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":10137,\"call timeout\":12,\"hook method selection\":1,\"simplex/duplex selection\":1,\"basic service information\":115,\"transmission grant\":1,\"transmission request permission\":0,\"call priority\":5,\"notification indicator\":31,\"temporary address\":8325053,\"calling party type identifier\":1,\"calling party ssi\":7675851}"},
+    {'C', "00111 01110111011111 1010 0 0 01100000 01 1 1111 1 1 111011 1 000111000101100001110100 1 10 110111100011110101101101 110000010110111111111101 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":7647,\"call timeout\":10,\"hook method selection\":0,\"simplex/duplex selection\":0,\"basic service information\":96,\"transmission grant\":1,\"transmission request permission\":1,\"call priority\":15,\"notification indicator\":59,\"temporary address\":1857652,\"calling party type identifier\":2,\"calling party ssi\":14564717,\"calling party ext\":12677117}"},
+    {'C', "00111 01000011011111 0110 0 1 00000111 10 1 1001 1 0 1 110011111010001100000001 1 10 111010011100000000110110 001110101100001101110111 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4319,\"call timeout\":6,\"hook method selection\":0,\"simplex/duplex selection\":1,\"basic service information\":7,\"transmission grant\":2,\"transmission request permission\":1,\"call priority\":9,\"temporary address\":13607681,\"calling party type identifier\":2,\"calling party ssi\":15319094,\"calling party ext\":3851127}"},
+
+    // CMCE D-TX CEASED
+    {'C', "01001 10010010011110 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CEASED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":9374,\"transmission request permission\":0}"},
+    {'C', "01001 00101101001000 1 1 1 100111 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CEASED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":2888,\"transmission request permission\":1,\"notification indicator\":39}"},
+    {'C', "01001 01000010010001 1 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CEASED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4241,\"transmission request permission\":1}"},
+
+    // CMCE D-TX CONTINUE
+    {'C', "01010 00011100011100 1 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CONTINUE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1820,\"continue\":1,\"transmission request permission\":1}"},
+    {'C', "01010 01000010100110 1 1 1 1 000010 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CONTINUE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4262,\"continue\":1,\"transmission request permission\":1,\"notification indicator\":2}"},
+    {'C', "01010 00001111111010 1 1 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX CONTINUE\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1018,\"continue\":1,\"transmission request permission\":1}"},
+
+    // CMCE D-TX GRANTED
+    {'C', "01011 00101001110111 10 1 0 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX GRANTED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":2679,\"transmission grant\":2,\"transmission request permission\":1,\"encryption control\":0}"},
+    {'C', "01011 01000101010111 11 1 0 0 1 1 100111 1 00 01010001 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX GRANTED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4439,\"transmission grant\":3,\"transmission request permission\":1,\"encryption control\":0,\"notification indicator\":39,\"transmission party type identifier\":0,\"transmitting party ssi\":81}"},
+    {'C', "01011 00010100000011 00 0 1 0 1 1 111101 1 01 100110010010111100000000 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX GRANTED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1283,\"transmission grant\":0,\"transmission request permission\":0,\"encryption control\":1,\"notification indicator\":61,\"transmission party type identifier\":1,\"transmitting party ssi\":10039040}"},
+    {'C', "01011 10110011011100 10 0 1 0 1 1 010111 1 10 001000000111111100110100 010001100001001001101000 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX GRANTED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":11484,\"transmission grant\":2,\"transmission request permission\":0,\"encryption control\":1,\"notification indicator\":23,\"transmission party type identifier\":2,\"transmitting party ssi\":2129716,\"transmitting party ext\":4592232}"},
+    {'C', "01011 11110110011010 00 1 1 0 1 0 1 00 10110001 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX GRANTED\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":15770,\"transmission grant\":0,\"transmission request permission\":1,\"encryption control\":1,\"transmission party type identifier\":0,\"transmitting party ssi\":177}"},
+
+    // CMCE D-TX INTERRUPT
+    {'C', "01101 10010000010010 00 1 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX INTERRUPT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":9234,\"transmission grant\":0,\"transmission request permission\":1,\"encryption control\":1}"},
+    {'C', "01101 10110100101101 11 1 1 0 1 1 110101 1 00 00101011 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX INTERRUPT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":11565,\"transmission grant\":3,\"transmission request permission\":1,\"encryption control\":1,\"notification indicator\":53,\"transmission party type identifier\":0,\"transmitting party ssi\":43}"},
+    {'C', "01101 00010010101011 00 1 1 0 1 1 000001 1 01 010100111001001011110001 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX INTERRUPT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":1195,\"transmission grant\":0,\"transmission request permission\":1,\"encryption control\":1,\"notification indicator\":1,\"transmission party type identifier\":1,\"transmitting party ssi\":5477105}"},
+    {'C', "01101 10110110100101 00 1 1 0 1 1 001110 1 10 010000111010001001111101 000100110001011010101111 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX INTERRUPT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":11685,\"transmission grant\":0,\"transmission request permission\":1,\"encryption control\":1,\"notification indicator\":14,\"transmission party type identifier\":2,\"transmitting party ssi\":4432509,\"transmitting party ext\":1250991}"},
+    {'C', "01101 10110111110100 00 1 0 0 1 0 1 01 000001110101010011110100 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX INTERRUPT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":11764,\"transmission grant\":0,\"transmission request permission\":1,\"encryption control\":0,\"transmission party type identifier\":1,\"transmitting party ssi\":480500}"},
+
+    // CMCE D-TX WAIT
+    {'C', "01100 01110110000001 1 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX WAIT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":7553,\"transmission request permission\":1}"},
+    {'C', "01100 01001010000101 1 1 1 110011 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX WAIT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":4741,\"transmission request permission\":1,\"notification indicator\":51}"},
+    {'C', "01100 01011101100000 0 1 0 0",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-TX WAIT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":5984,\"transmission request permission\":0}"},
+
+    // CMCE D-SETUP, truncated
+    {'C', "00111 11101100110010 0010 1",
+     "{\"service\":\"CMCE\",\"pdu\":\"D-SETUP\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"call identifier\":15154,\"call timeout\":2,\"hook method selection\":1,\"simplex/duplex selection\":0,\"basic service information\":0,\"transmission grant\":0,\"transmission request permission\":0,\"call priority\":0}"},
+
+    // MM D-ATTACH/DETACH GROUP IDENTITY
+    {'M', "1010 1 0 1 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"Group identity report request\":\"true\",\"Group identity acknowledgement requested\":\"false\",\"Group identity attach/detach mode\":\"Detach all and attach\"}"},
+    {'M', "1010 0 1 0 1 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"Group identity report request\":\"false\",\"Group identity acknowledgement requested\":\"true\",\"Group identity attach/detach mode\":\"Amendment\"}"},
+    {'M', "1010 1 1 1 1 1 0001 00000000010 10 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"Group identity report request\":\"true\",\"Group identity acknowledgement requested\":\"true\",\"Group identity attach/detach mode\":\"Detach all and attach\",\"Type 3/4 element identifier\":\"Default group attachment lifetime\",\"Length indicator\":2,\"Default group attachment lifetime\":\"Attachment not allowed for next ITSI attach\"}"},
+
+    // MM D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT
+    {'M', "1011 0 0 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"All attachment/detachments accepted\":\"true\"}"},
+    {'M', "1011 1 0 1 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"All attachment/detachments accepted\":\"false\"}"},
+    {'M', "1011 0 0 1 1 0001 00000000010 01 0",
+     "{\"service\":\"MM\",\"pdu\":\"D-ATTACH/DETACH GROUP IDENTITY ACKNOWLEDGEMENT\",\"tn\":0,\"fn\":0,\"mn\":0,\"ssi\":0,\"usage marker\":0,\"encryption mode\":0,\"address_type\":0,\"All attachment/detachments accepted\":\"true\",\"Type 3/4 element identifier\":\"Default group attachment lifetime\",\"Length indicator\":2,\"Default group attachment lifetime\":\"Attachment for next ITSI attach required\"}"},
+};
+
+/**
+ * @brief Receive pending reports, without their time
+ *
+ */
+
+static std::string receiveReports(zmq::socket_t & socket)
+{
+    std::string res;
+    zmq::message_t msg;
+
+    while (socket.recv(msg, zmq::recv_flags::dontwait))
+    {
+        std::string report(static_cast<const char *>(msg.data()), msg.size());
+
+        const std::size_t start = report.find("\"time\":\"");
+        if (start != std::string::npos)
+        {
+            report.erase(start, report.find("\",", start) + 2 - start);
+        }
+        res += report;
+    }
+
+    return res;
+}
+
+/**
+ * @brief Parsers driven by PDU layouts report the same as the hand-written parsers
+ *
+ * Golden PDUs go through their layer service(), reports are received from an
+ * inproc ZMQ socket and compared to the golden ones.
+ *
+ */
+
+static bool testPduLayoutReports()
+{
+    zmq::context_t context(1);
+    zmq::socket_t reportSocket(context, zmq::socket_type::pull);
+    reportSocket.bind("inproc://test-reports");
+    zmq::socket_t layerSocket(context, zmq::socket_type::push);
+    layerSocket.connect("inproc://test-reports");
+
+    Log log(LogLevel::NONE);
+    Report report(&layerSocket, &log);
+    Sds sds(&log, &report);
+    Cmce cmce(&log, &report, &sds);
+    Mm mm(&log, &report);
+
+    const TetraTime tetraTime = {};
+    const MacAddress macAddress = {};
+
+    const std::size_t count = sizeof(REPORT_GOLDENS) / sizeof(REPORT_GOLDENS[0]);
+    std::size_t errors = 0;
+
+    for (std::size_t idx = 0; idx < count; idx++)
+    {
+        const ReportGolden & golden = REPORT_GOLDENS[idx];
+
+        std::vector<uint8_t> bits;
+        for (const char * bit = golden.bits; *bit != '\0'; bit++)
+        {
+            if (*bit != ' ')
+            {
+                bits.push_back((uint8_t)(*bit - '0'));
+            }
+        }
+
+        Layer * layer = (golden.layer == 'C') ? (Layer *)&cmce : (Layer *)&mm;
+        layer->service(Pdu(bits), TCH, tetraTime, macAddress);
+
+        const std::string reports = receiveReports(reportSocket);
+        if (reports != std::string(golden.report) + "\n")
+        {
+            errors++;
+            printf("  pdu layouts: wrong report for %s\n    %s", golden.bits, reports.c_str());
+        }
+    }
+
+    printf("%s pdu layouts: %zu reports, %zu mismatches\n", errors ? "FAIL" : "PASS", count, errors);
+
+    return errors == 0;
+}
+
+int main()
+{
+    bool bOk = true;
+
+    bOk = testViterbi1614() && bOk;
+    bOk = testScramblingCache() && bOk;
+    bOk = testReedMuller3014() && bOk;
+    bOk = testCrc32Words() && bOk;
+    bOk = testPduLayoutReports() && bOk;
+
+    return bOk ? 0 : 1;
+}
@@ -27,11 +27,11 @@ UPlane::~UPlane()
  *
  */
 
-void UPlane::service(Pdu pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode)
+void UPlane::service(const Pdu & pdu, const MacLogicalChannel macLogicalChannel, TetraTime tetraTime, MacAddress macAddress, MacState macState, uint8_t encryptionMode)
 {
     Layer::service(macLogicalChannel, tetraTime, macAddress);
 
-    m_log->print(LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s encr = %u\n", "service_u_plane", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str(), encryptionMode);
+    LOG_PRINT(m_log, LogLevel::HIGH, "DEBUG ::%-44s - mac_channel = %s pdu = %s encr = %u\n", "service_u_plane", macLogicalChannelName(macLogicalChannel).c_str(), pdu.toString().c_str(), encryptionMode);
 
     if (macLogicalChannel == TCH_S)                                             // speech frame
     {
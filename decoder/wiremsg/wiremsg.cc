@@ -86,7 +86,7 @@ uint8_t WireMsg::tetraChannelToGsmChannel(const enum MacLogicalChannel channel)
  *
  */
 
-void WireMsg::sendMsg(const enum MacLogicalChannel tetraChannel, const struct TetraTime tetraTime, Pdu pdu)
+void WireMsg::sendMsg(const enum MacLogicalChannel tetraChannel, const struct TetraTime tetraTime, const Pdu & pdu)
 {
     struct gsmtapHdr hdr;
     unsigned int hdrLen = sizeof(gsmtapHdr);
@@ -64,7 +64,7 @@ namespace Tetra {
         ~WireMsg();
 
         uint8_t tetraChannelToGsmChannel(const enum MacLogicalChannel channel);
-        void sendMsg(const enum MacLogicalChannel tetraChannel, const struct TetraTime tetraTime, Pdu pdu);
+        void sendMsg(const enum MacLogicalChannel tetraChannel, const struct TetraTime tetraTime, const Pdu & pdu);
     private:
         int m_socketFd;
     };